@@ -0,0 +1,145 @@
+#include "pch.h"
+#include "Common.h"
+#include "AsyncIO.h"
+
+// Each request runs on its own std::async task. It's a portable stand-in
+// for overlapped I/O, and for a handful of files at a time it's all we need.
+
+AsyncIO::AsyncIO (size_t _maxOutstanding) : maxOutstanding (_maxOutstanding)
+{
+	if (maxOutstanding == 0)
+		maxOutstanding = 1;
+}
+
+AsyncIO::~AsyncIO()
+{
+	Flush();
+}
+
+void AsyncIO::Prefetch (const std::wstring& filename)
+{
+	Throttle();
+
+	Request r;
+	r.filename = filename;
+	r.isRead = true;
+	r.data = std::make_shared<std::vector<uint8_t>>();
+	auto data = r.data;
+	r.done = std::async (std::launch::async, [filename, data]()
+	{
+		std::ifstream f (filename, std::ios::in | std::ios::binary);
+		if (!f)
+			return false;
+		data->assign ((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+		return true;
+	}).share();
+
+	requests.push_back (r);
+}
+
+bool AsyncIO::Read (const std::wstring& filename, std::vector<uint8_t>& v)
+{
+	for (auto it = requests.begin(); it != requests.end(); ++it)
+	{
+		if (it->isRead && it->filename == filename)
+		{
+			bool ok = it->done.get();
+			v.swap (*it->data);
+			requests.erase (it);
+			return ok;
+		}
+	}
+
+	// Not prefetched, so read it now.
+	std::ifstream f (filename, std::ios::in | std::ios::binary);
+	if (!f)
+		return false;
+	v.assign ((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+
+	return true;
+}
+
+void AsyncIO::Write (const std::wstring& filename, std::vector<uint8_t> v)
+{
+	Throttle();
+
+	Request r;
+	r.filename = filename;
+	r.isRead = false;
+	r.data = std::make_shared<std::vector<uint8_t>>();
+	r.data->swap (v);
+	auto data = r.data;
+	r.done = std::async (std::launch::async, [filename, data]()
+	{
+		std::ofstream f (filename, std::ios::out | std::ofstream::binary);
+		std::copy (data->begin(), data->end(), std::ostreambuf_iterator<char>(f));
+		return (bool)f;
+	}).share();
+
+	requests.push_back (r);
+}
+
+void AsyncIO::WriteText (const std::wstring& filename, std::vector<std::wstring> v)
+{
+	Throttle();
+
+	Request r;
+	r.filename = filename;
+	r.isRead = false;
+	auto text = std::make_shared<std::vector<std::wstring>>();
+	text->swap (v);
+	r.done = std::async (std::launch::async, [filename, text]()
+	{
+		return WriteVectorToTextFile (filename, *text) != 0;
+	}).share();
+
+	requests.push_back (r);
+}
+
+void AsyncIO::Flush()
+{
+	for (auto& r : requests)
+		r.done.wait();
+
+	// Finished writes are of no further interest. Prefetched data is kept
+	// until somebody Read()s it.
+	for (auto it = requests.begin(); it != requests.end();)
+	{
+		if (!it->isRead)
+			it = requests.erase (it);
+		else
+			++it;
+	}
+}
+
+void AsyncIO::Throttle()
+{
+	// Drop finished writes, then wait for the oldest unfinished requests
+	// until we're below the limit.
+	for (;;)
+	{
+		size_t outstanding = 0;
+		Request* pOldest = nullptr;
+		for (auto it = requests.begin(); it != requests.end();)
+		{
+			bool ready = it->done.wait_for (std::chrono::seconds (0)) == std::future_status::ready;
+			if (ready && !it->isRead)
+			{
+				it = requests.erase (it);
+				continue;
+			}
+			if (!ready)
+			{
+				outstanding++;
+				if (!pOldest)
+					pOldest = &*it;
+			}
+			++it;
+		}
+
+		if (outstanding < maxOutstanding)
+			return;
+
+		pOldest->done.wait();
+	}
+}
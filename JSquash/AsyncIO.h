@@ -0,0 +1,57 @@
+#pragma once
+
+#include <future>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Background file I/O for batch runs.
+//
+// Reads can be started ahead of need (Prefetch) and writes are queued, so
+// minification carries on while the disk catches up. At most
+// maxOutstanding requests are in flight at once; issuing another waits
+// for the oldest unfinished one. The destructor waits for everything.
+//
+// Usage:
+//
+//	AsyncIO io;
+//	io.Prefetch (L"b.js");			// starts reading b.js
+//	io.Read (L"a.js", js);			// a.js wasn't prefetched, so reads it now
+//	io.Write (L"a_min.js", jsNew);	// returns straight away
+//	io.Flush();						// wait for all writes to land
+//
+class AsyncIO
+{
+public:
+	AsyncIO (size_t maxOutstanding = 4);
+	~AsyncIO();
+
+	// Start reading a file in the background.
+	void Prefetch (const std::wstring& filename);
+
+	// Get a file's contents, waiting for a prefetch if there was one.
+	// Returns false if the file couldn't be opened.
+	bool Read (const std::wstring& filename, std::vector<uint8_t>& v);
+
+	// Queue a write. The data is moved into the request.
+	void Write (const std::wstring& filename, std::vector<uint8_t> v);
+	void WriteText (const std::wstring& filename, std::vector<std::wstring> v);
+
+	// Wait for all outstanding requests to complete.
+	void Flush();
+
+private:
+	struct Request
+	{
+		std::wstring filename;
+		bool isRead;
+		std::shared_ptr<std::vector<uint8_t>> data;
+		std::shared_future<bool> done;
+	};
+
+	void Throttle();
+
+	size_t maxOutstanding;
+	std::deque<Request> requests;
+};
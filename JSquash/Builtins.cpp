@@ -0,0 +1,503 @@
+#include "pch.h"
+#include "Common.h"
+#include "Builtins.h"
+#include "CodeMap.h"
+#include <algorithm>
+#include <cstring>
+
+// Keywords and reserved words, strict and contextual alike (ES2025), plus
+// constructor, which is special in any class body; the globals of ES2025,
+// the HTML window and Node; the own and prototype property names of the
+// ES2025 built-ins, plus the DOM, CSSOM, HTML, Fetch, Streams, Web Audio and
+// other Web API members that scripts commonly use. Window members are
+// globals as well as properties, the on... event handlers, name, status
+// and event included: a script can read or set them bare, eg. onload=f.
+const char* const builtinNamesVersion = "2026.10.1";
+
+enum { K = BuiltinKeyword, G = BuiltinGlobal, P = BuiltinProperty };
+
+static const BuiltinName builtinNames[] = {
+	{ "AbortController", G|P }, { "AbortSignal", G|P }, { "AbstractRange", G }, { "ActiveXObject", G },
+	{ "AggregateError", G|P }, { "AnalyserNode", G }, { "Animation", G }, { "AnimationEffect", G },
+	{ "AnimationEvent", G }, { "AnimationPlaybackEvent", G }, { "AnimationTimeline", G }, { "Array", G|P },
+	{ "ArrayBuffer", G|P }, { "Atomics", G|P }, { "Attr", G }, { "Audio", G }, { "AudioBuffer", G },
+	{ "AudioBufferSourceNode", G }, { "AudioContext", G }, { "AudioDestinationNode", G }, { "AudioListener", G },
+	{ "AudioNode", G }, { "AudioParam", G }, { "AudioProcessingEvent", G }, { "AudioWorklet", G },
+	{ "AudioWorkletNode", G }, { "BYTES_PER_ELEMENT", P }, { "BarProp", G }, { "BaseAudioContext", G },
+	{ "BeforeUnloadEvent", G }, { "BigInt", G|P }, { "BigInt64Array", G|P }, { "BigUint64Array", G|P },
+	{ "BiquadFilterNode", G }, { "Blob", G|P }, { "BlobEvent", G }, { "Boolean", G|P },
+	{ "BroadcastChannel", G|P }, { "Buffer", G|P }, { "ByteLengthQueuingStrategy", G|P }, { "CDATASection", G },
+	{ "CSS", G }, { "CSSAnimation", G }, { "CSSConditionRule", G }, { "CSSFontFaceRule", G },
+	{ "CSSGroupingRule", G }, { "CSSImportRule", G }, { "CSSKeyframeRule", G }, { "CSSKeyframesRule", G },
+	{ "CSSMediaRule", G }, { "CSSNamespaceRule", G }, { "CSSPageRule", G }, { "CSSRule", G },
+	{ "CSSRuleList", G }, { "CSSStyleDeclaration", G }, { "CSSStyleRule", G }, { "CSSStyleSheet", G },
+	{ "CSSSupportsRule", G }, { "CSSTransition", G }, { "Cache", G }, { "CacheStorage", G },
+	{ "CanvasCaptureMediaStreamTrack", G }, { "CanvasGradient", G }, { "CanvasPattern", G },
+	{ "CanvasRenderingContext2D", G }, { "ChannelMergerNode", G }, { "ChannelSplitterNode", G },
+	{ "CharacterData", G }, { "Clipboard", G }, { "ClipboardEvent", G }, { "ClipboardItem", G },
+	{ "CloseEvent", G }, { "Collator", P }, { "Comment", G }, { "CompositionEvent", G },
+	{ "CompressionStream", G|P }, { "ConstantSourceNode", G }, { "ConvolverNode", G },
+	{ "CountQueuingStrategy", G|P }, { "Credential", G }, { "CredentialsContainer", G }, { "Crypto", G|P },
+	{ "CryptoKey", G|P }, { "CustomElementRegistry", G }, { "CustomEvent", G|P }, { "DOMException", G|P },
+	{ "DOMImplementation", G }, { "DOMMatrix", G }, { "DOMMatrixReadOnly", G }, { "DOMParser", G },
+	{ "DOMPoint", G }, { "DOMPointReadOnly", G }, { "DOMQuad", G }, { "DOMRect", G }, { "DOMRectList", G },
+	{ "DOMRectReadOnly", G }, { "DOMStringList", G }, { "DOMStringMap", G }, { "DOMTokenList", G },
+	{ "DataTransfer", G }, { "DataTransferItem", G }, { "DataTransferItemList", G }, { "DataView", G|P },
+	{ "Date", G|P }, { "DateTimeFormat", P }, { "DecompressionStream", G|P }, { "DelayNode", G },
+	{ "DeviceMotionEvent", G }, { "DeviceOrientationEvent", G }, { "DisplayNames", P }, { "Document", G },
+	{ "DocumentFragment", G }, { "DocumentType", G }, { "DragEvent", G }, { "DynamicsCompressorNode", G },
+	{ "E", P }, { "EPSILON", P }, { "Element", G }, { "ElementInternals", G }, { "Error", G|P },
+	{ "ErrorEvent", G }, { "EvalError", G|P }, { "Event", G|P }, { "EventSource", G }, { "EventTarget", G|P },
+	{ "File", G|P }, { "FileList", G }, { "FileReader", G }, { "FileSystemDirectoryHandle", G },
+	{ "FileSystemFileHandle", G }, { "FileSystemHandle", G }, { "FinalizationRegistry", G|P },
+	{ "Float32Array", G|P }, { "Float64Array", G|P }, { "FocusEvent", G }, { "FontFace", G },
+	{ "FontFaceSet", G }, { "FormData", G|P }, { "FormDataEvent", G }, { "Function", G|P }, { "GainNode", G },
+	{ "Gamepad", G }, { "GamepadButton", G }, { "GamepadEvent", G }, { "Geolocation", G },
+	{ "GeolocationCoordinates", G }, { "GeolocationPosition", G }, { "GeolocationPositionError", G },
+	{ "HTMLAllCollection", G }, { "HTMLAnchorElement", G }, { "HTMLAreaElement", G }, { "HTMLAudioElement", G },
+	{ "HTMLBRElement", G }, { "HTMLBaseElement", G }, { "HTMLBodyElement", G }, { "HTMLButtonElement", G },
+	{ "HTMLCanvasElement", G }, { "HTMLCollection", G }, { "HTMLDListElement", G }, { "HTMLDataElement", G },
+	{ "HTMLDataListElement", G }, { "HTMLDetailsElement", G }, { "HTMLDialogElement", G },
+	{ "HTMLDivElement", G }, { "HTMLDocument", G }, { "HTMLElement", G }, { "HTMLEmbedElement", G },
+	{ "HTMLFieldSetElement", G }, { "HTMLFormControlsCollection", G }, { "HTMLFormElement", G },
+	{ "HTMLFrameSetElement", G }, { "HTMLHRElement", G }, { "HTMLHeadElement", G }, { "HTMLHeadingElement", G },
+	{ "HTMLHtmlElement", G }, { "HTMLIFrameElement", G }, { "HTMLImageElement", G }, { "HTMLInputElement", G },
+	{ "HTMLLIElement", G }, { "HTMLLabelElement", G }, { "HTMLLegendElement", G }, { "HTMLLinkElement", G },
+	{ "HTMLMapElement", G }, { "HTMLMediaElement", G }, { "HTMLMenuElement", G }, { "HTMLMetaElement", G },
+	{ "HTMLMeterElement", G }, { "HTMLModElement", G }, { "HTMLOListElement", G }, { "HTMLObjectElement", G },
+	{ "HTMLOptGroupElement", G }, { "HTMLOptionElement", G }, { "HTMLOptionsCollection", G },
+	{ "HTMLOutputElement", G }, { "HTMLParagraphElement", G }, { "HTMLPictureElement", G },
+	{ "HTMLPreElement", G }, { "HTMLProgressElement", G }, { "HTMLQuoteElement", G }, { "HTMLScriptElement", G },
+	{ "HTMLSelectElement", G }, { "HTMLSlotElement", G }, { "HTMLSourceElement", G }, { "HTMLSpanElement", G },
+	{ "HTMLStyleElement", G }, { "HTMLTableCaptionElement", G }, { "HTMLTableCellElement", G },
+	{ "HTMLTableColElement", G }, { "HTMLTableElement", G }, { "HTMLTableRowElement", G },
+	{ "HTMLTableSectionElement", G }, { "HTMLTemplateElement", G }, { "HTMLTextAreaElement", G },
+	{ "HTMLTimeElement", G }, { "HTMLTitleElement", G }, { "HTMLTrackElement", G }, { "HTMLUListElement", G },
+	{ "HTMLUnknownElement", G }, { "HTMLVideoElement", G }, { "HashChangeEvent", G }, { "Headers", G|P },
+	{ "History", G }, { "IDBCursor", G }, { "IDBCursorWithValue", G }, { "IDBDatabase", G }, { "IDBFactory", G },
+	{ "IDBIndex", G }, { "IDBKeyRange", G }, { "IDBObjectStore", G }, { "IDBOpenDBRequest", G },
+	{ "IDBRequest", G }, { "IDBTransaction", G }, { "IDBVersionChangeEvent", G }, { "IIRFilterNode", G },
+	{ "IdleDeadline", G }, { "Image", G }, { "ImageBitmap", G }, { "ImageBitmapRenderingContext", G },
+	{ "ImageData", G }, { "Infinity", K|G|P }, { "InputEvent", G }, { "Int16Array", G|P }, { "Int32Array", G|P },
+	{ "Int8Array", G|P }, { "IntersectionObserver", G }, { "IntersectionObserverEntry", G }, { "Intl", G|P },
+	{ "Iterator", G }, { "JSON", G|P }, { "KeyboardEvent", G }, { "KeyframeEffect", G }, { "LN10", P },
+	{ "LN2", P }, { "LOG10E", P }, { "LOG2E", P }, { "ListFormat", P }, { "Locale", P }, { "Location", G },
+	{ "Lock", G }, { "LockManager", G }, { "MAX_SAFE_INTEGER", P }, { "MAX_VALUE", P }, { "MIN_SAFE_INTEGER", P },
+	{ "MIN_VALUE", P }, { "Map", G|P }, { "Math", G|P }, { "MediaDeviceInfo", G }, { "MediaDevices", G },
+	{ "MediaElementAudioSourceNode", G }, { "MediaEncryptedEvent", G }, { "MediaError", G }, { "MediaList", G },
+	{ "MediaMetadata", G }, { "MediaQueryList", G }, { "MediaQueryListEvent", G }, { "MediaRecorder", G },
+	{ "MediaSession", G }, { "MediaSource", G }, { "MediaStream", G }, { "MediaStreamAudioDestinationNode", G },
+	{ "MediaStreamAudioSourceNode", G }, { "MediaStreamTrack", G }, { "MediaStreamTrackEvent", G },
+	{ "MessageChannel", G|P }, { "MessageEvent", G|P }, { "MessagePort", G|P }, { "MimeType", G },
+	{ "MimeTypeArray", G }, { "MouseEvent", G }, { "MutationObserver", G }, { "MutationRecord", G },
+	{ "NEGATIVE_INFINITY", P }, { "NaN", K|G|P }, { "NamedNodeMap", G }, { "Navigator", G }, { "Node", G },
+	{ "NodeFilter", G }, { "NodeIterator", G }, { "NodeList", G }, { "Notification", G }, { "Number", G|P },
+	{ "NumberFormat", P }, { "Object", G|P }, { "OfflineAudioCompletionEvent", G }, { "OfflineAudioContext", G },
+	{ "OffscreenCanvas", G }, { "OffscreenCanvasRenderingContext2D", G }, { "Option", G },
+	{ "OscillatorNode", G }, { "OverconstrainedError", G }, { "PI", P }, { "POSITIVE_INFINITY", P },
+	{ "PageTransitionEvent", G }, { "PannerNode", G }, { "Path2D", G }, { "PaymentRequest", G },
+	{ "Performance", G|P }, { "PerformanceEntry", G|P }, { "PerformanceMark", G|P },
+	{ "PerformanceMeasure", G|P }, { "PerformanceNavigation", G }, { "PerformanceNavigationTiming", G },
+	{ "PerformanceObserver", G|P }, { "PerformanceObserverEntryList", G|P }, { "PerformanceResourceTiming", G|P },
+	{ "PerformanceTiming", G }, { "PeriodicWave", G }, { "PermissionStatus", G }, { "Permissions", G },
+	{ "PictureInPictureWindow", G }, { "Plugin", G }, { "PluginArray", G }, { "PluralRules", P },
+	{ "PointerEvent", G }, { "PopStateEvent", G }, { "ProcessingInstruction", G }, { "ProgressEvent", G },
+	{ "Promise", G|P }, { "PromiseRejectionEvent", G }, { "Proxy", G|P }, { "PushManager", G },
+	{ "PushSubscription", G }, { "RTCDataChannel", G }, { "RTCIceCandidate", G }, { "RTCPeerConnection", G },
+	{ "RTCSessionDescription", G }, { "RadioNodeList", G }, { "Range", G }, { "RangeError", G|P },
+	{ "ReadableByteStreamController", G|P }, { "ReadableStream", G|P }, { "ReadableStreamBYOBReader", G|P },
+	{ "ReadableStreamBYOBRequest", G|P }, { "ReadableStreamDefaultController", G|P },
+	{ "ReadableStreamDefaultReader", G|P }, { "ReferenceError", G|P }, { "Reflect", G|P }, { "RegExp", G|P },
+	{ "RelativeTimeFormat", P }, { "Request", G|P }, { "ResizeObserver", G }, { "ResizeObserverEntry", G },
+	{ "ResizeObserverSize", G }, { "Response", G|P }, { "SQRT1_2", P }, { "SQRT2", P }, { "SVGAElement", G },
+	{ "SVGAngle", G }, { "SVGAnimatedLength", G }, { "SVGAnimatedString", G }, { "SVGCircleElement", G },
+	{ "SVGClipPathElement", G }, { "SVGDefsElement", G }, { "SVGElement", G }, { "SVGEllipseElement", G },
+	{ "SVGGElement", G }, { "SVGGeometryElement", G }, { "SVGGradientElement", G }, { "SVGGraphicsElement", G },
+	{ "SVGImageElement", G }, { "SVGLength", G }, { "SVGLineElement", G }, { "SVGLinearGradientElement", G },
+	{ "SVGMarkerElement", G }, { "SVGMaskElement", G }, { "SVGMatrix", G }, { "SVGPathElement", G },
+	{ "SVGPatternElement", G }, { "SVGPoint", G }, { "SVGPolygonElement", G }, { "SVGPolylineElement", G },
+	{ "SVGRadialGradientElement", G }, { "SVGRect", G }, { "SVGRectElement", G }, { "SVGSVGElement", G },
+	{ "SVGStopElement", G }, { "SVGSymbolElement", G }, { "SVGTSpanElement", G }, { "SVGTextContentElement", G },
+	{ "SVGTextElement", G }, { "SVGTextPathElement", G }, { "SVGTitleElement", G }, { "SVGTransform", G },
+	{ "SVGUseElement", G }, { "Screen", G }, { "ScreenOrientation", G }, { "ScriptProcessorNode", G },
+	{ "SecurityPolicyViolationEvent", G }, { "Segmenter", P }, { "Selection", G }, { "ServiceWorker", G },
+	{ "ServiceWorkerContainer", G }, { "ServiceWorkerRegistration", G }, { "Set", G|P }, { "ShadowRoot", G },
+	{ "SharedArrayBuffer", G|P }, { "SharedWorker", G }, { "SourceBuffer", G }, { "SourceBufferList", G },
+	{ "SpeechSynthesis", G }, { "SpeechSynthesisEvent", G }, { "SpeechSynthesisUtterance", G },
+	{ "SpeechSynthesisVoice", G }, { "StaticRange", G }, { "StereoPannerNode", G }, { "Storage", G },
+	{ "StorageEvent", G }, { "StorageManager", G }, { "String", G|P }, { "StyleSheet", G },
+	{ "StyleSheetList", G }, { "SubmitEvent", G }, { "SubtleCrypto", G|P }, { "Symbol", G|P },
+	{ "SyntaxError", G|P }, { "Text", G }, { "TextDecoder", G|P }, { "TextDecoderStream", G|P },
+	{ "TextEncoder", G|P }, { "TextEncoderStream", G|P }, { "TextMetrics", G }, { "TextTrack", G },
+	{ "TextTrackCue", G }, { "TextTrackCueList", G }, { "TextTrackList", G }, { "TimeRanges", G }, { "Touch", G },
+	{ "TouchEvent", G }, { "TouchList", G }, { "TrackEvent", G }, { "TransformStream", G|P },
+	{ "TransformStreamDefaultController", G|P }, { "TransitionEvent", G }, { "TreeWalker", G },
+	{ "TypeError", G|P }, { "UIEvent", G }, { "URIError", G|P }, { "URL", G|P }, { "URLSearchParams", G|P },
+	{ "UTC", P }, { "Uint16Array", G|P }, { "Uint32Array", G|P }, { "Uint8Array", G|P },
+	{ "Uint8ClampedArray", G|P }, { "VTTCue", G }, { "ValidityState", G }, { "VisualViewport", G },
+	{ "WaveShaperNode", G }, { "WeakMap", G|P }, { "WeakRef", G|P }, { "WeakSet", G|P }, { "WebAssembly", P },
+	{ "WebGL2RenderingContext", G }, { "WebGLActiveInfo", G }, { "WebGLBuffer", G }, { "WebGLFramebuffer", G },
+	{ "WebGLProgram", G }, { "WebGLQuery", G }, { "WebGLRenderbuffer", G }, { "WebGLRenderingContext", G },
+	{ "WebGLSampler", G }, { "WebGLShader", G }, { "WebGLShaderPrecisionFormat", G }, { "WebGLSync", G },
+	{ "WebGLTexture", G }, { "WebGLTransformFeedback", G }, { "WebGLUniformLocation", G },
+	{ "WebGLVertexArrayObject", G }, { "WebSocket", G }, { "WheelEvent", G }, { "Window", G }, { "Worker", G },
+	{ "Worklet", G }, { "WritableStream", G|P }, { "WritableStreamDefaultController", G|P },
+	{ "WritableStreamDefaultWriter", G|P }, { "XMLDocument", G }, { "XMLHttpRequest", G },
+	{ "XMLHttpRequestEventTarget", G }, { "XMLHttpRequestUpload", G }, { "XMLSerializer", G },
+	{ "XPathEvaluator", G }, { "XPathExpression", G }, { "XPathResult", G }, { "XSLTProcessor", G },
+	{ "__defineGetter__", P }, { "__defineSetter__", P }, { "__dirname", G }, { "__esModule", P },
+	{ "__filename", G }, { "__lookupGetter__", P }, { "__lookupSetter__", P }, { "__proto__", P }, { "abort", P },
+	{ "aborted", P }, { "abs", P }, { "accept", P }, { "acceptCharset", P }, { "accessKey", P },
+	{ "accuracy", P }, { "acos", P }, { "acosh", P }, { "action", P }, { "active", P }, { "activeElement", P },
+	{ "actualBoundingBoxAscent", P }, { "actualBoundingBoxDescent", P }, { "actualBoundingBoxLeft", P },
+	{ "actualBoundingBoxRight", P }, { "add", P }, { "addColorStop", P }, { "addEventListener", G|P },
+	{ "addListener", P }, { "addRange", P }, { "addTrack", P }, { "addedNodes", P }, { "adoptNode", P },
+	{ "adoptedCallback", P }, { "after", P }, { "alert", G }, { "alignContent", P }, { "alignItems", P },
+	{ "alignSelf", P }, { "all", P }, { "allSettled", P }, { "allow", P }, { "allowFullscreen", P }, { "alt", P },
+	{ "altKey", P }, { "altitude", P }, { "ancestorOrigins", P }, { "anchor", P }, { "anchorNode", P },
+	{ "anchorOffset", P }, { "anchors", P }, { "and", P }, { "angle", P }, { "animate", P }, { "animation", P },
+	{ "animationDuration", P }, { "animationName", P }, { "any", P }, { "appName", P }, { "appVersion", P },
+	{ "append", P }, { "appendChild", P }, { "apply", P }, { "arc", P }, { "arcTo", P }, { "arguments", K|P },
+	{ "arrayBuffer", P }, { "asIntN", P }, { "asUintN", P }, { "asin", P }, { "asinh", P }, { "assign", P },
+	{ "assignedSlot", P }, { "async", K|P }, { "asyncDispose", P }, { "asyncIterator", P }, { "at", P },
+	{ "atan", P }, { "atan2", P }, { "atanh", P }, { "atob", G|P }, { "attachShadow", P },
+	{ "attributeChangedCallback", P }, { "attributeFilter", P }, { "attributeName", P },
+	{ "attributeNamespace", P }, { "attributeOldValue", P }, { "attributes", P }, { "autocomplete", P },
+	{ "autofocus", P }, { "autoplay", P }, { "availHeight", P }, { "availWidth", P }, { "await", K },
+	{ "back", P }, { "background", P }, { "backgroundColor", P }, { "backgroundImage", P },
+	{ "backgroundPosition", P }, { "backgroundRepeat", P }, { "backgroundSize", P }, { "baseName", P },
+	{ "baseURI", P }, { "before", P }, { "beginPath", P }, { "bezierCurveTo", P }, { "big", P },
+	{ "binaryType", P }, { "bind", P }, { "blink", P }, { "blob", P }, { "blur", P }, { "body", P },
+	{ "bodyUsed", P }, { "bold", P }, { "border", P }, { "borderBottom", P }, { "borderBoxSize", P },
+	{ "borderCollapse", P }, { "borderColor", P }, { "borderLeft", P }, { "borderRadius", P },
+	{ "borderRight", P }, { "borderStyle", P }, { "borderTop", P }, { "borderWidth", P }, { "bottom", P },
+	{ "boundingClientRect", P }, { "boxShadow", P }, { "boxSizing", P }, { "break", K }, { "btoa", G|P },
+	{ "bubbles", P }, { "buffer", P }, { "buffered", P }, { "bufferedAmount", P }, { "button", P },
+	{ "buttons", P }, { "byteLength", P }, { "byteOffset", P }, { "cache", P }, { "caches", G },
+	{ "calendar", P }, { "calendars", P }, { "call", P }, { "callee", P }, { "caller", P }, { "canPlayType", P },
+	{ "canShare", P }, { "cancel", P }, { "cancelAnimationFrame", G }, { "cancelBubble", P },
+	{ "cancelIdleCallback", G }, { "cancelable", P }, { "caption", P }, { "captureStackTrace", P },
+	{ "captureStream", P }, { "caretRangeFromPoint", P }, { "case", K }, { "caseFirst", P }, { "catch", K|P },
+	{ "cause", P }, { "cbrt", P }, { "ceil", P }, { "cellIndex", P }, { "cells", P }, { "changedTouches", P },
+	{ "charAt", P }, { "charCode", P }, { "charCodeAt", P }, { "characterData", P },
+	{ "characterDataOldValue", P }, { "characterSet", P }, { "charset", P }, { "checkValidity", P },
+	{ "checked", P }, { "childElementCount", P }, { "childList", P }, { "childNodes", P }, { "children", P },
+	{ "class", K }, { "classList", P }, { "className", P }, { "clear", P }, { "clearData", P },
+	{ "clearImmediate", G|P }, { "clearInterval", G|P }, { "clearMarks", P }, { "clearMeasures", P },
+	{ "clearRect", P }, { "clearTimeout", G|P }, { "clearWatch", P }, { "click", P }, { "clientHeight", P },
+	{ "clientLeft", P }, { "clientTop", P }, { "clientWidth", P }, { "clientX", P }, { "clientY", P },
+	{ "clip", P }, { "clipPath", P }, { "clipboard", P }, { "clipboardData", P }, { "clone", P },
+	{ "cloneContents", P }, { "cloneNode", P }, { "cloneRange", P }, { "close", P }, { "closePath", P },
+	{ "closed", G|P }, { "closest", P }, { "clz32", P }, { "code", P }, { "codePointAt", P }, { "colSpan", P },
+	{ "collapse", P }, { "collapseToEnd", P }, { "collapseToStart", P }, { "collapsed", P }, { "collation", P },
+	{ "collations", P }, { "color", P }, { "colorDepth", P }, { "cols", P }, { "commonAncestorContainer", P },
+	{ "compare", P }, { "compareDocumentPosition", P }, { "compareExchange", P }, { "compatMode", P },
+	{ "compile", P }, { "complete", P }, { "composed", P }, { "composedPath", P }, { "concat", P },
+	{ "configurable", P }, { "confirm", G }, { "connect", P }, { "connectedCallback", P }, { "connection", P },
+	{ "console", G|P }, { "const", K }, { "construct", P }, { "constructor", K|P }, { "contains", P },
+	{ "containsNode", P }, { "content", P }, { "contentBoxSize", P }, { "contentDocument", P },
+	{ "contentEditable", P }, { "contentRect", P }, { "contentType", P }, { "contentWindow", P },
+	{ "continue", K }, { "controller", P }, { "controls", P }, { "cookie", P }, { "cookieEnabled", P },
+	{ "coords", P }, { "copyWithin", P }, { "cos", P }, { "cosh", P }, { "create", P }, { "createAnalyser", P },
+	{ "createAttribute", P }, { "createBiquadFilter", P }, { "createBuffer", P }, { "createBufferSource", P },
+	{ "createCaption", P }, { "createComment", P }, { "createConicGradient", P }, { "createDelay", P },
+	{ "createDocumentFragment", P }, { "createDynamicsCompressor", P }, { "createElement", P },
+	{ "createElementNS", P }, { "createEvent", P }, { "createGain", P }, { "createImageBitmap", G },
+	{ "createImageData", P }, { "createLinearGradient", P }, { "createMediaElementSource", P },
+	{ "createMediaStreamSource", P }, { "createNodeIterator", P }, { "createObjectURL", P },
+	{ "createOscillator", P }, { "createPanner", P }, { "createPattern", P }, { "createRadialGradient", P },
+	{ "createRange", P }, { "createTBody", P }, { "createTFoot", P }, { "createTHead", P },
+	{ "createTextNode", P }, { "createTreeWalker", P }, { "credentials", P }, { "crossOrigin", P },
+	{ "crossOriginIsolated", G }, { "crypto", G|P }, { "cssFloat", P }, { "cssText", P }, { "ctrlKey", P },
+	{ "currentScript", P }, { "currentSrc", P }, { "currentTarget", P }, { "currentTime", P }, { "cursor", P },
+	{ "customElements", G }, { "data", P }, { "dataTransfer", P }, { "dataset", P }, { "debugger", K },
+	{ "decode", P }, { "decodeURI", G|P }, { "decodeURIComponent", G|P }, { "decoding", P }, { "decrypt", P },
+	{ "default", K }, { "defaultChecked", P }, { "defaultPrevented", P }, { "defaultSelected", P },
+	{ "defaultValue", P }, { "defaultView", P }, { "defer", P }, { "define", P }, { "defineProperties", P },
+	{ "defineProperty", P }, { "delegatesFocus", P }, { "delete", K|P }, { "deleteCaption", P },
+	{ "deleteCell", P }, { "deleteContents", P }, { "deleteFromDocument", P }, { "deleteProperty", P },
+	{ "deleteRow", P }, { "deleteTFoot", P }, { "deleteTHead", P }, { "deltaMode", P }, { "deltaX", P },
+	{ "deltaY", P }, { "deltaZ", P }, { "deref", P }, { "deriveBits", P }, { "deriveKey", P },
+	{ "description", P }, { "designMode", P }, { "desiredSize", P }, { "destination", P }, { "detach", P },
+	{ "detail", P }, { "deviceMemory", P }, { "devicePixelRatio", G }, { "digest", P }, { "dir", P },
+	{ "direction", P }, { "disabled", P }, { "disconnect", P }, { "disconnectedCallback", P },
+	{ "dispatchEvent", G|P }, { "display", P }, { "dispose", P }, { "do", K }, { "doctype", P },
+	{ "document", G }, { "documentElement", P }, { "documentURI", P }, { "domain", P }, { "done", P },
+	{ "dotAll", P }, { "download", P }, { "draggable", P }, { "drawImage", P }, { "dropEffect", P },
+	{ "duration", P }, { "effectAllowed", P }, { "elementFromPoint", P }, { "elements", P },
+	{ "elementsFromPoint", P }, { "ellipse", P }, { "else", K }, { "embeds", P }, { "enabled", P },
+	{ "encode", P }, { "encodeInto", P }, { "encodeURI", G|P }, { "encodeURIComponent", G|P }, { "encoding", P },
+	{ "encrypt", P }, { "enctype", P }, { "endContainer", P }, { "endOffset", P }, { "ended", P },
+	{ "endsWith", P }, { "enqueue", P }, { "entries", P }, { "entryType", P }, { "enum", K }, { "enumerable", P },
+	{ "enumerateDevices", P }, { "error", P }, { "errors", P }, { "escape", G|P }, { "eval", K|G|P },
+	{ "event", G|P }, { "eventPhase", P }, { "every", P }, { "exchange", P }, { "exec", P }, { "execCommand", P },
+	{ "exitFullscreen", P }, { "exitPointerLock", P }, { "exp", P }, { "expm1", P }, { "export", K },
+	{ "exportKey", P }, { "exports", G }, { "extend", P }, { "extends", K }, { "extensions", P },
+	{ "external", P }, { "extractContents", P }, { "false", K }, { "fastSeek", P }, { "fetch", G|P },
+	{ "files", P }, { "fill", P }, { "fillRect", P }, { "fillStyle", P }, { "fillText", P }, { "filter", P },
+	{ "finally", K|P }, { "find", P }, { "findIndex", P }, { "findLast", P }, { "findLastIndex", P },
+	{ "firstChild", P }, { "firstElementChild", P }, { "fixed", P }, { "flags", P }, { "flat", P },
+	{ "flatMap", P }, { "flex", P }, { "flexBasis", P }, { "flexDirection", P }, { "flexGrow", P },
+	{ "flexShrink", P }, { "flexWrap", P }, { "float", P }, { "floor", P }, { "focus", P }, { "focusNode", P },
+	{ "focusOffset", P }, { "font", P }, { "fontFamily", P }, { "fontSize", P }, { "fontStyle", P },
+	{ "fontWeight", P }, { "fontcolor", P }, { "fonts", P }, { "fontsize", P }, { "for", K|P }, { "forEach", P },
+	{ "force", P }, { "form", P }, { "formData", P }, { "format", P }, { "formatRange", P },
+	{ "formatRangeToParts", P }, { "formatToParts", P }, { "forms", P }, { "forward", P }, { "frameElement", G },
+	{ "frames", G|P }, { "freeze", P }, { "frequency", P }, { "from", P }, { "fromCharCode", P },
+	{ "fromCodePoint", P }, { "fromEntries", P }, { "fround", P }, { "fulfilled", P }, { "fullscreenElement", P },
+	{ "function", K }, { "gain", P }, { "gap", P }, { "generateKey", P }, { "geolocation", P }, { "get", K|P },
+	{ "getAll", P }, { "getAllResponseHeaders", P }, { "getAnimations", P }, { "getAttribute", P },
+	{ "getAttributeNS", P }, { "getAttributeNames", P }, { "getAttributeNode", P }, { "getAudioTracks", P },
+	{ "getBigInt64", P }, { "getBigUint64", P }, { "getBoundingClientRect", P }, { "getCanonicalLocales", P },
+	{ "getClientRects", P }, { "getComputedStyle", G }, { "getContext", P }, { "getCurrentPosition", P },
+	{ "getData", P }, { "getDate", P }, { "getDay", P }, { "getDisplayMedia", P }, { "getElementById", P },
+	{ "getElementsByClassName", P }, { "getElementsByName", P }, { "getElementsByTagName", P },
+	{ "getElementsByTagNameNS", P }, { "getEntries", P }, { "getEntriesByName", P }, { "getEntriesByType", P },
+	{ "getFloat32", P }, { "getFloat64", P }, { "getFullYear", P }, { "getHours", P }, { "getImageData", P },
+	{ "getInt16", P }, { "getInt32", P }, { "getInt8", P }, { "getItem", P }, { "getLineDash", P },
+	{ "getMilliseconds", P }, { "getMinutes", P }, { "getModifierState", P }, { "getMonth", P },
+	{ "getNotifications", P }, { "getOwnPropertyDescriptor", P }, { "getOwnPropertyDescriptors", P },
+	{ "getOwnPropertyNames", P }, { "getOwnPropertySymbols", P }, { "getPropertyPriority", P },
+	{ "getPropertyValue", P }, { "getPrototypeOf", P }, { "getRandomValues", P }, { "getRangeAt", P },
+	{ "getReader", P }, { "getResponseHeader", P }, { "getRootNode", P }, { "getSeconds", P },
+	{ "getSelection", G|P }, { "getSetCookie", P }, { "getTime", P }, { "getTimezoneOffset", P },
+	{ "getTracks", P }, { "getTransform", P }, { "getUTCDate", P }, { "getUTCDay", P }, { "getUTCFullYear", P },
+	{ "getUTCHours", P }, { "getUTCMilliseconds", P }, { "getUTCMinutes", P }, { "getUTCMonth", P },
+	{ "getUTCSeconds", P }, { "getUint16", P }, { "getUint32", P }, { "getUint8", P }, { "getUserMedia", P },
+	{ "getVideoTracks", P }, { "getWriter", P }, { "getYear", P }, { "global", G|P }, { "globalAlpha", P },
+	{ "globalCompositeOperation", P }, { "globalThis", G|P }, { "go", P }, { "grid", P }, { "gridArea", P },
+	{ "gridColumn", P }, { "gridRow", P }, { "gridTemplateColumns", P }, { "gridTemplateRows", P },
+	{ "groups", P }, { "grow", P }, { "growable", P }, { "handleEvent", P }, { "hardwareConcurrency", P },
+	{ "has", P }, { "hasAttribute", P }, { "hasAttributeNS", P }, { "hasAttributes", P }, { "hasChildNodes", P },
+	{ "hasFocus", P }, { "hasIndices", P }, { "hasInstance", P }, { "hasOwn", P }, { "hasOwnProperty", P },
+	{ "hasPointerCapture", P }, { "hash", P }, { "head", P }, { "headers", P }, { "heading", P }, { "height", P },
+	{ "hidden", P }, { "history", G }, { "host", P }, { "hostname", P }, { "hourCycle", P }, { "hourCycles", P },
+	{ "href", P }, { "hreflang", P }, { "hypot", P }, { "id", P }, { "identifier", P }, { "if", K },
+	{ "ignoreCase", P }, { "imageSmoothingEnabled", P }, { "images", P }, { "implementation", P },
+	{ "implements", K }, { "import", K }, { "importKey", P }, { "importNode", P }, { "importScripts", G },
+	{ "imul", P }, { "in", K }, { "includes", P }, { "indeterminate", P }, { "index", P }, { "indexOf", P },
+	{ "indexedDB", G }, { "indices", P }, { "inert", P }, { "innerHTML", P }, { "innerHeight", G },
+	{ "innerText", P }, { "innerWidth", G }, { "input", P }, { "inputType", P }, { "insertAdjacentElement", P },
+	{ "insertAdjacentHTML", P }, { "insertAdjacentText", P }, { "insertBefore", P }, { "insertCell", P },
+	{ "insertNode", P }, { "insertRow", P }, { "installing", P }, { "instanceof", K }, { "integrity", P },
+	{ "interface", K }, { "intersectionRatio", P }, { "intersectionRect", P }, { "is", P }, { "isArray", P },
+	{ "isCollapsed", P }, { "isComposing", P }, { "isConcatSpreadable", P }, { "isConnected", P },
+	{ "isContentEditable", P }, { "isDefaultNamespace", P }, { "isEqualNode", P }, { "isExtensible", P },
+	{ "isFinite", G|P }, { "isFrozen", P }, { "isInteger", P }, { "isIntersecting", P }, { "isLockFree", P },
+	{ "isMap", P }, { "isNaN", G|P }, { "isPointInPath", P }, { "isPointInStroke", P }, { "isPrimary", P },
+	{ "isPrototypeOf", P }, { "isSafeInteger", P }, { "isSameNode", P }, { "isSealed", P },
+	{ "isSecureContext", G }, { "isTrusted", P }, { "isView", P }, { "isWellFormed", P }, { "italics", P },
+	{ "item", P }, { "items", P }, { "iterator", P }, { "join", P }, { "json", P }, { "justifyContent", P },
+	{ "keepalive", P }, { "key", P }, { "keyCode", P }, { "keyFor", P }, { "keys", P }, { "kind", P },
+	{ "label", P }, { "labels", P }, { "lang", P }, { "language", P }, { "languages", P }, { "lastChild", P },
+	{ "lastElementChild", P }, { "lastEventId", P }, { "lastIndex", P }, { "lastIndexOf", P }, { "lastMatch", P },
+	{ "lastModified", P }, { "lastParen", P }, { "latitude", P }, { "layerX", P }, { "layerY", P }, { "left", P },
+	{ "leftContext", P }, { "length", P }, { "lengthComputable", P }, { "let", K }, { "letterSpacing", P },
+	{ "lineCap", P }, { "lineDashOffset", P }, { "lineHeight", P }, { "lineJoin", P }, { "lineTo", P },
+	{ "lineWidth", P }, { "link", P }, { "links", P }, { "list", P }, { "listStyle", P }, { "load", P },
+	{ "loaded", P }, { "loading", P }, { "localName", P }, { "localStorage", G }, { "localeCompare", P },
+	{ "location", G|P }, { "locationbar", G }, { "lock", P }, { "log", P }, { "log10", P }, { "log1p", P },
+	{ "log2", P }, { "longitude", P }, { "lookupNamespaceURI", P }, { "lookupPrefix", P }, { "loop", P },
+	{ "map", P }, { "margin", P }, { "marginBottom", P }, { "marginLeft", P }, { "marginRight", P },
+	{ "marginTop", P }, { "mark", P }, { "match", P }, { "matchAll", P }, { "matchMedia", G }, { "matches", P },
+	{ "max", P }, { "maxByteLength", P }, { "maxHeight", P }, { "maxLength", P }, { "maxTouchPoints", P },
+	{ "maxWidth", P }, { "maximize", P }, { "measure", P }, { "measureText", P }, { "media", P },
+	{ "mediaDevices", P }, { "menubar", G }, { "message", P }, { "metaKey", P }, { "method", P }, { "min", P },
+	{ "minHeight", P }, { "minLength", P }, { "minWidth", P }, { "minimize", P }, { "miterLimit", P },
+	{ "mode", P }, { "module", G }, { "moveBy", G }, { "moveTo", G|P }, { "movementX", P }, { "movementY", P },
+	{ "multiline", P }, { "multiple", P }, { "muted", P }, { "name", G|P }, { "namedItem", P },
+	{ "namespaceURI", P }, { "naturalHeight", P }, { "naturalWidth", P }, { "navigation", P }, { "navigator", G },
+	{ "networkState", P }, { "new", K }, { "next", P }, { "nextElementSibling", P }, { "nextSibling", P },
+	{ "noModule", P }, { "noValidate", P }, { "nodeName", P }, { "nodeType", P }, { "nodeValue", P },
+	{ "nonce", P }, { "normalize", P }, { "notify", P }, { "now", P }, { "null", K }, { "numberingSystem", P },
+	{ "numberingSystems", P }, { "numeric", P }, { "objectFit", P }, { "observe", P },
+	{ "observedAttributes", P }, { "of", K|P }, { "offsetHeight", P }, { "offsetLeft", P }, { "offsetParent", P },
+	{ "offsetTop", P }, { "offsetWidth", P }, { "offsetX", P }, { "offsetY", P }, { "ok", P }, { "oldValue", P },
+	{ "onLine", P }, { "onabort", G|P }, { "onafterprint", G|P }, { "onanimationend", G|P },
+	{ "onanimationiteration", G|P }, { "onanimationstart", G|P }, { "onbeforeprint", G|P }, { "onbeforeunload", G|P },
+	{ "onblur", G|P }, { "onchange", G|P }, { "onclick", G|P }, { "onclose", G|P }, { "oncontextmenu", G|P },
+	{ "ondblclick", G|P }, { "ondevicemotion", G|P }, { "ondeviceorientation", G|P }, { "ondrag", G|P },
+	{ "ondragend", G|P }, { "ondragenter", G|P }, { "ondragleave", G|P }, { "ondragover", G|P }, { "ondragstart", G|P },
+	{ "ondrop", G|P }, { "onerror", G|P }, { "onfocus", G|P }, { "onhashchange", G|P }, { "oninput", G|P },
+	{ "onkeydown", G|P }, { "onkeypress", G|P }, { "onkeyup", G|P }, { "onload", G|P }, { "onloadend", P },
+	{ "onloadstart", G|P }, { "onmessage", G|P }, { "onmessageerror", G|P }, { "onmousedown", G|P },
+	{ "onmouseenter", G|P }, { "onmouseleave", G|P }, { "onmousemove", G|P }, { "onmouseout", G|P }, { "onmouseover", G|P },
+	{ "onmouseup", G|P }, { "onoffline", G|P }, { "ononline", G|P }, { "onopen", P }, { "onpagehide", G|P },
+	{ "onpageshow", G|P }, { "onpointercancel", G|P }, { "onpointerdown", G|P }, { "onpointerenter", G|P },
+	{ "onpointerleave", G|P }, { "onpointermove", G|P }, { "onpointerout", G|P }, { "onpointerover", G|P },
+	{ "onpointerup", G|P }, { "onpopstate", G|P }, { "onprogress", G|P }, { "onreadystatechange", P },
+	{ "onrejectionhandled", G|P }, { "onreset", G|P }, { "onresize", G|P }, { "onscroll", G|P }, { "onselect", G|P },
+	{ "onselectionchange", G|P }, { "onstorage", G|P }, { "onsubmit", G|P }, { "ontimeout", P }, { "ontouchcancel", G|P },
+	{ "ontouchend", G|P }, { "ontouchmove", G|P }, { "ontouchstart", G|P }, { "ontransitionend", G|P },
+	{ "onunhandledrejection", G|P }, { "onunload", G|P }, { "onvisibilitychange", P }, { "onwheel", G|P },
+	{ "opacity", P }, { "open", P }, { "opener", G|P }, { "options", P }, { "or", P }, { "order", P },
+	{ "orientation", P }, { "origin", G|P }, { "outerHTML", P }, { "outerHeight", G }, { "outerText", P },
+	{ "outerWidth", G }, { "outline", P }, { "overflow", P }, { "overflowX", P }, { "overflowY", P },
+	{ "overrideMimeType", P }, { "ownKeys", P }, { "ownerDocument", P }, { "package", K }, { "padEnd", P },
+	{ "padStart", P }, { "padding", P }, { "paddingBottom", P }, { "paddingLeft", P }, { "paddingRight", P },
+	{ "paddingTop", P }, { "pageX", P }, { "pageXOffset", G }, { "pageY", P }, { "pageYOffset", G },
+	{ "parent", G }, { "parentElement", P }, { "parentNode", P }, { "parentRule", P }, { "parse", P },
+	{ "parseFloat", G|P }, { "parseInt", G|P }, { "part", P }, { "password", P }, { "pathname", P },
+	{ "pattern", P }, { "pause", P }, { "paused", P }, { "performance", G|P }, { "permission", P },
+	{ "permissions", P }, { "personalbar", G }, { "ping", P }, { "pipeThrough", P }, { "pipeTo", P },
+	{ "pitch", P }, { "pixelDepth", P }, { "placeholder", P }, { "platform", P }, { "play", P },
+	{ "playbackRate", P }, { "playbackState", P }, { "played", P }, { "plugins", P }, { "pointerEvents", P },
+	{ "pointerId", P }, { "pointerLockElement", P }, { "pointerType", P }, { "pop", P }, { "popover", P },
+	{ "port", P }, { "port1", P }, { "port2", P }, { "ports", P }, { "position", P }, { "postMessage", G|P },
+	{ "poster", P }, { "pow", P }, { "prefix", P }, { "preload", P }, { "prepareStackTrace", P },
+	{ "prepend", P }, { "pressure", P }, { "preventDefault", P }, { "preventExtensions", P },
+	{ "previousElementSibling", P }, { "previousSibling", P }, { "print", P }, { "private", K },
+	{ "process", G|P }, { "product", P }, { "prompt", G }, { "propertyIsEnumerable", P }, { "protected", K },
+	{ "protocol", P }, { "prototype", P }, { "public", K }, { "push", P }, { "pushState", P },
+	{ "putImageData", P }, { "quadraticCurveTo", P }, { "queryCommandEnabled", P }, { "queryCommandState", P },
+	{ "queryCommandValue", P }, { "querySelector", P }, { "querySelectorAll", P }, { "queueMicrotask", G|P },
+	{ "race", P }, { "radiusX", P }, { "radiusY", P }, { "random", P }, { "randomUUID", P }, { "rangeCount", P },
+	{ "rate", P }, { "raw", P }, { "read", P }, { "readAsArrayBuffer", P }, { "readAsBinaryString", P },
+	{ "readAsDataURL", P }, { "readAsText", P }, { "readOnly", P }, { "readText", P }, { "ready", P },
+	{ "readyState", P }, { "reason", P }, { "rect", P }, { "redirect", P }, { "redirected", P }, { "reduce", P },
+	{ "reduceRight", P }, { "referrer", P }, { "referrerPolicy", P }, { "region", P }, { "register", P },
+	{ "reject", P }, { "rejected", P }, { "rel", P }, { "relList", P }, { "relatedTarget", P },
+	{ "releaseLock", P }, { "releasePointerCapture", P }, { "reload", P }, { "remove", P },
+	{ "removeAllRanges", P }, { "removeAttribute", P }, { "removeAttributeNS", P }, { "removeChild", P },
+	{ "removeEventListener", G|P }, { "removeItem", P }, { "removeListener", P }, { "removeProperty", P },
+	{ "removeRange", P }, { "removeTrack", P }, { "removedNodes", P }, { "repeat", P }, { "replace", P },
+	{ "replaceAll", P }, { "replaceChild", P }, { "replaceChildren", P }, { "replaceState", P },
+	{ "replaceWith", P }, { "reportError", G }, { "reportValidity", P }, { "requestAnimationFrame", G|P },
+	{ "requestFullscreen", P }, { "requestIdleCallback", G }, { "requestPermission", P },
+	{ "requestPictureInPicture", P }, { "requestPointerLock", P }, { "requestSubmit", P }, { "require", G },
+	{ "required", P }, { "reset", P }, { "resetTransform", P }, { "resizable", P }, { "resize", P },
+	{ "resizeBy", G }, { "resizeTo", G }, { "resolve", P }, { "resolvedOptions", P }, { "response", P },
+	{ "responseText", P }, { "responseType", P }, { "responseURL", P }, { "responseXML", P }, { "restore", P },
+	{ "result", P }, { "resume", P }, { "return", K|P }, { "returnValue", P }, { "reverse", P },
+	{ "revocable", P }, { "revokeObjectURL", P }, { "right", P }, { "rightContext", P }, { "rootBounds", P },
+	{ "rotate", P }, { "rotationAngle", P }, { "round", P }, { "roundRect", P }, { "rowIndex", P },
+	{ "rowSpan", P }, { "rows", P }, { "sampleRate", P }, { "sandbox", P }, { "save", P }, { "scale", P },
+	{ "scheduler", G }, { "scope", P }, { "screen", G }, { "screenLeft", G }, { "screenTop", G },
+	{ "screenX", G|P }, { "screenY", G|P }, { "script", P }, { "scripts", P }, { "scroll", P },
+	{ "scrollBy", G|P }, { "scrollHeight", P }, { "scrollIntoView", P }, { "scrollIntoViewIfNeeded", P },
+	{ "scrollLeft", P }, { "scrollRestoration", P }, { "scrollTo", G|P }, { "scrollTop", P },
+	{ "scrollWidth", P }, { "scrollX", G }, { "scrollY", G }, { "scrollbars", G }, { "seal", P }, { "search", P },
+	{ "searchParams", P }, { "sectionRowIndex", P }, { "seekable", P }, { "seeking", P }, { "segment", P },
+	{ "select", P }, { "selectAllChildren", P }, { "selectNode", P }, { "selectNodeContents", P },
+	{ "selectRange", P }, { "selected", P }, { "selectedIndex", P }, { "selectedOptions", P },
+	{ "selectionDirection", P }, { "selectionEnd", P }, { "selectionStart", P }, { "self", G }, { "send", P },
+	{ "sendBeacon", P }, { "serviceWorker", P }, { "sessionStorage", G }, { "set", K|P }, { "setAttribute", P },
+	{ "setAttributeNS", P }, { "setAttributeNode", P }, { "setBigInt64", P }, { "setBigUint64", P },
+	{ "setCustomValidity", P }, { "setData", P }, { "setDate", P }, { "setDragImage", P }, { "setEnd", P },
+	{ "setEndAfter", P }, { "setEndBefore", P }, { "setFloat32", P }, { "setFloat64", P }, { "setFullYear", P },
+	{ "setHours", P }, { "setImmediate", G|P }, { "setInt16", P }, { "setInt32", P }, { "setInt8", P },
+	{ "setInterval", G|P }, { "setItem", P }, { "setLineDash", P }, { "setMilliseconds", P }, { "setMinutes", P },
+	{ "setMonth", P }, { "setPointerCapture", P }, { "setProperty", P }, { "setPrototypeOf", P },
+	{ "setRangeText", P }, { "setRequestHeader", P }, { "setSeconds", P }, { "setSelectionRange", P },
+	{ "setStart", P }, { "setStartAfter", P }, { "setStartBefore", P }, { "setTime", P }, { "setTimeout", G|P },
+	{ "setTransform", P }, { "setUTCDate", P }, { "setUTCFullYear", P }, { "setUTCHours", P },
+	{ "setUTCMilliseconds", P }, { "setUTCMinutes", P }, { "setUTCMonth", P }, { "setUTCSeconds", P },
+	{ "setUint16", P }, { "setUint32", P }, { "setUint8", P }, { "setYear", P }, { "shadowBlur", P },
+	{ "shadowColor", P }, { "shadowOffsetX", P }, { "shadowOffsetY", P }, { "shadowRoot", P }, { "share", P },
+	{ "sheet", P }, { "shift", P }, { "shiftKey", P }, { "showNotification", P }, { "sign", P }, { "signal", P },
+	{ "sin", P }, { "sinh", P }, { "size", P }, { "sizes", P }, { "slice", P }, { "slot", P }, { "small", P },
+	{ "some", P }, { "sort", P }, { "source", P }, { "speak", P }, { "species", P }, { "speechSynthesis", G },
+	{ "speed", P }, { "spellcheck", P }, { "splice", P }, { "split", P }, { "sqrt", P }, { "src", P },
+	{ "srcElement", P }, { "srcObject", P }, { "srcdoc", P }, { "srcset", P }, { "stack", P },
+	{ "stackTraceLimit", P }, { "start", P }, { "startContainer", P }, { "startOffset", P }, { "startTime", P },
+	{ "startsWith", P }, { "state", P }, { "static", K }, { "status", G|P }, { "statusText", P },
+	{ "statusbar", G }, { "step", P }, { "stepDown", P }, { "stepUp", P }, { "sticky", P }, { "stop", P },
+	{ "stopImmediatePropagation", P }, { "stopPropagation", P }, { "storage", P }, { "store", P },
+	{ "stream", P }, { "strike", P }, { "stringify", P }, { "stroke", P }, { "strokeRect", P },
+	{ "strokeStyle", P }, { "strokeText", P }, { "structuredClone", G|P }, { "style", P }, { "styleSheets", P },
+	{ "sub", P }, { "subarray", P }, { "submit", P }, { "substr", P }, { "substring", P }, { "subtle", P },
+	{ "subtree", P }, { "sup", P }, { "super", K }, { "supportedLocalesOf", P }, { "supportedValuesOf", P },
+	{ "supports", P }, { "surroundContents", P }, { "suspend", P }, { "switch", K }, { "tBodies", P },
+	{ "tFoot", P }, { "tHead", P }, { "tabIndex", P }, { "tagName", P }, { "takeRecords", P }, { "tan", P },
+	{ "tangentialPressure", P }, { "tanh", P }, { "target", P }, { "targetTouches", P }, { "tee", P },
+	{ "terminate", P }, { "test", P }, { "text", P }, { "textAlign", P }, { "textBaseline", P },
+	{ "textContent", P }, { "textDecoration", P }, { "textInfo", P }, { "textOverflow", P }, { "textShadow", P },
+	{ "textTracks", P }, { "textTransform", P }, { "then", P }, { "this", K }, { "throw", K|P },
+	{ "throwIfAborted", P }, { "tiltX", P }, { "tiltY", P }, { "timeOrigin", P }, { "timeStamp", P },
+	{ "timeZones", P }, { "timeline", P }, { "timeout", P }, { "timing", P }, { "title", P }, { "toBlob", P },
+	{ "toDataURL", P }, { "toDateString", P }, { "toExponential", P }, { "toFixed", P }, { "toGMTString", P },
+	{ "toISOString", P }, { "toJSON", P }, { "toLocaleDateString", P }, { "toLocaleLowerCase", P },
+	{ "toLocaleString", P }, { "toLocaleTimeString", P }, { "toLocaleUpperCase", P }, { "toLowerCase", P },
+	{ "toPrecision", P }, { "toPrimitive", P }, { "toReversed", P }, { "toSorted", P }, { "toSpliced", P },
+	{ "toString", P }, { "toStringTag", P }, { "toTimeString", P }, { "toUTCString", P }, { "toUpperCase", P },
+	{ "toWellFormed", P }, { "toggle", P }, { "toggleAttribute", P }, { "toolbar", G }, { "top", G|P },
+	{ "total", P }, { "touches", P }, { "transferControlToOffscreen", P }, { "transform", P },
+	{ "transformOrigin", P }, { "transition", P }, { "transitionDelay", P }, { "transitionDuration", P },
+	{ "transitionProperty", P }, { "translate", P }, { "trim", P }, { "trimEnd", P }, { "trimLeft", P },
+	{ "trimRight", P }, { "trimStart", P }, { "true", K }, { "trunc", P }, { "trustedTypes", G }, { "try", K },
+	{ "twist", P }, { "type", P }, { "typeof", K }, { "types", P }, { "undefined", K|G|P }, { "unescape", G|P },
+	{ "unicode", P }, { "unicodeSets", P }, { "unlock", P }, { "unobserve", P }, { "unregister", P },
+	{ "unscopables", P }, { "unshift", P }, { "update", P }, { "upgrade", P }, { "upload", P }, { "useMap", P },
+	{ "userAgent", P }, { "userSelect", P }, { "username", P }, { "validationMessage", P }, { "validity", P },
+	{ "value", P }, { "valueAsDate", P }, { "valueAsNumber", P }, { "valueOf", P }, { "values", P }, { "var", K },
+	{ "vendor", P }, { "verify", P }, { "verticalAlign", P }, { "vibrate", P }, { "videoHeight", P },
+	{ "videoWidth", P }, { "visibility", P }, { "visibilityState", P }, { "visualViewport", G }, { "voices", P },
+	{ "void", K }, { "volume", P }, { "wait", P }, { "waitAsync", P }, { "waiting", P }, { "wasClean", P },
+	{ "watchPosition", P }, { "webkitMatchesSelector", P }, { "webkitRelativePath", P }, { "weekInfo", P },
+	{ "wheelDelta", P }, { "whenDefined", P }, { "which", P }, { "while", K }, { "whiteSpace", P },
+	{ "width", P }, { "willChange", P }, { "willValidate", P }, { "window", G }, { "with", K|P },
+	{ "withCredentials", P }, { "wordBreak", P }, { "wordWrap", P }, { "wrap", P }, { "writable", P },
+	{ "write", P }, { "writeText", P }, { "writeln", P }, { "x", P }, { "xor", P }, { "y", P }, { "yield", K },
+	{ "zIndex", P },
+};
+
+const BuiltinName* BuiltinNames (size_t& count)
+{
+	count = sizeof (builtinNames) / sizeof (builtinNames[0]);
+	return builtinNames;
+}
+
+int BuiltinKinds (const std::string& name)
+{
+	auto end = builtinNames + sizeof (builtinNames) / sizeof (builtinNames[0]);
+	auto it = std::lower_bound (builtinNames, end, name.c_str(), [](const BuiltinName& b, const char* s)
+	{
+		return strcmp (b.name, s) < 0;
+	});
+	return it != end && name == it->name ? it->kinds : 0;
+}
+
+bool UsedAsProperty (const std::vector<uint8_t>& js, size_t posStart, size_t posEnd)
+{
+	size_t posPrev = posStart;
+	while (posPrev > 0 && isspace (js[posPrev - 1]))
+		posPrev--;
+	uint8_t prev = posPrev > 0 ? js[posPrev - 1] : 0;
+
+	size_t posNext = posEnd;
+	while (posNext < js.size() && isspace (js[posNext]))
+		posNext++;
+	uint8_t next = posNext < js.size() ? js[posNext] : 0;
+
+	// obj.name, obj?.name, but not ...name.
+	if (prev == '.')
+		return !(posPrev >= 2 && js[posPrev - 2] == '.');
+
+	// { name: ... }. Also catches a ? name : b and case name:, which only
+	// keeps a name that could have been renamed.
+	if (next == ':')
+		return true;
+
+	// Shorthand { name }, { name = 1 } = o, and methods { name() {} }.
+	if (prev && strchr ("{,", prev) && next && strchr ("},=(", next))
+		return true;
+
+	// Class members after the first, and generator methods. A field needn't
+	// end with ';', so a member may follow anything on the line before.
+	if (next == '(' && prev && strchr ("};*", prev))
+		return true;
+	if (next == '(' && std::find (js.begin() + posPrev, js.begin() + posStart, '\n') != js.begin() + posStart)
+		return true;
+
+	// get name() {}, static name() {}, async name() {}.
+	if (next == '(' && IsNameChar (prev))
+	{
+		size_t posWord = posPrev;
+		while (posWord > 0 && IsNameChar (js[posWord - 1]))
+			posWord--;
+		std::string word (js.begin() + posWord, js.begin() + posPrev);
+		return word == "get" || word == "set" || word == "static" || word == "async";
+	}
+
+	return false;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+// Built-in identifier database: the ECMAScript keywords, the globals of the
+// language, browsers and Node, and the property names of the standard
+// library and the DOM/Web APIs. Compiled in as one sorted table.
+//
+// Keywords and globals are always reserved. A property name is only
+// reserved when the js actually uses it as a property (see
+// UsedAsProperty); otherwise it's just a name like any other and can be
+// renamed. So a local "value" or "index" gets a short name unless the code
+// also says .value or index: somewhere.
+
+enum BuiltinKind
+{
+	BuiltinKeyword = 1 << 0,
+	BuiltinGlobal = 1 << 1,
+	BuiltinProperty = 1 << 2,
+};
+
+struct BuiltinName
+{
+	const char* name;
+	uint8_t kinds;		// BuiltinKind bits.
+};
+
+// Identifies the edition of the table, shown in the stats.
+extern const char* const builtinNamesVersion;
+
+// The whole table, in strcmp order.
+const BuiltinName* BuiltinNames (size_t& count);
+
+// The BuiltinKind bits of name, or 0 if it isn't in the table.
+int BuiltinKinds (const std::string& name);
+
+// True if the symbol at js[posStart, posEnd) is written as a property: after
+// a '.', before a ':' (an object key), as a shorthand key or a method in an
+// object or class body, or after get/set/static/async.
+bool UsedAsProperty (const std::vector<uint8_t>& js, size_t posStart, size_t posEnd);
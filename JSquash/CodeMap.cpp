@@ -0,0 +1,258 @@
+#include "pch.h"
+#include "Common.h"
+#include "CodeMap.h"
+#include <cstring>
+
+// From JSquash.cpp
+std::wstring CheckForComment (int& pos, const std::vector<uint8_t>& js);
+void CheckForQuotedString (const WCHAR& c, int pos, int& posStart, int& posEnd, WCHAR& quoteMark);
+
+bool IsNameChar (int c)
+{
+	return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == '$';
+}
+
+static int RegexEnd (const std::vector<uint8_t>& js1, int pos)
+{
+	// If the '/' at pos starts a regex literal, returns the position of its
+	// last char (flags included), else -1. A '/' starts a regex if whatever
+	// came before can't be the end of an operand.
+	int pos1 = pos;
+	while (--pos1 >= 0 && isspace (js1[pos1]))
+		;
+	if (pos1 >= 0 && !strchr ("(,=:[!&|?{};+-*%<>~^", js1[pos1]))
+	{
+		int posWord = pos1;
+		while (posWord >= 0 && IsNameChar (js1[posWord]))
+			posWord--;
+		std::string word (js1.begin() + posWord + 1, js1.begin() + pos1 + 1);
+		if (word != "return" && word != "typeof" && word != "case" && word != "in" && word != "of")
+			return -1;
+	}
+
+	int size = js1.size();
+	bool inClass = false;
+	for (pos1 = pos + 1; pos1 < size && js1[pos1] != '\r' && js1[pos1] != '\n'; ++pos1)
+	{
+		uint8_t c = js1[pos1];
+		if (c == '\\')
+			pos1++;
+		else if (c == '[')
+			inClass = true;
+		else if (c == ']')
+			inClass = false;
+		else if (c == '/' && !inClass)
+		{
+			while (pos1 + 1 < size && IsNameChar (js1[pos1 + 1]))
+				pos1++;
+			return pos1;
+		}
+	}
+
+	return -1;
+}
+
+std::vector<bool> MapCode (const std::vector<uint8_t>& js1, std::vector<bool>* pStrings)
+{
+	int size = js1.size();
+	std::vector<bool> vCode (size, true);
+	if (pStrings)
+		pStrings->assign (size, false);
+
+	int pos = 0;
+	WCHAR quoteMark = 0;
+	int posStart = -1;
+	int posEnd = -1;
+	bool inTemplate = false;		// In the text of a template literal.
+	std::vector<int> vTemplates;	// Brace depth in each open ${...}, innermost last.
+	while (pos < size)
+	{
+		if (inTemplate)
+		{
+			// Template text isn't code, but a ${...} in it is, up to its '}'.
+			uint8_t c = js1[pos];
+			vCode[pos] = false;
+			if (c == '\\' && pos + 1 < size)
+				vCode[++pos] = false;
+			else if (c == '`')
+				inTemplate = false;
+			else if (c == '$' && pos + 1 < size && js1[pos + 1] == '{')
+			{
+				vCode[++pos] = false;
+				vTemplates.push_back (0);
+				inTemplate = false;
+			}
+			pos++;
+			continue;
+		}
+
+		if (posStart < 0)
+		{
+			uint8_t c = js1[pos];
+			if (c == '`')
+			{
+				vCode[pos++] = false;
+				inTemplate = true;
+				continue;
+			}
+			if (vTemplates.size() && c == '{')
+				vTemplates.back()++;
+			else if (vTemplates.size() && c == '}')
+			{
+				if (vTemplates.back() == 0)
+				{
+					vTemplates.pop_back();
+					vCode[pos++] = false;
+					inTemplate = true;
+					continue;
+				}
+				vTemplates.back()--;
+			}
+
+			int posComment = pos;
+			if (CheckForComment (pos, js1).size())
+			{
+				for (int i = posComment; i <= pos && i < size; ++i)
+					vCode[i] = false;
+				pos++;
+				continue;
+			}
+
+			int posRegexEnd = js1[pos] == '/' ? RegexEnd (js1, pos) : -1;
+			if (posRegexEnd >= 0)
+			{
+				for (int i = pos; i <= posRegexEnd; ++i)
+					vCode[i] = false;
+				pos = posRegexEnd + 1;
+				continue;
+			}
+		}
+
+		CheckForQuotedString (js1[pos], pos, posStart, posEnd, quoteMark);
+		if (posStart >= 0)
+		{
+			vCode[pos] = false;
+			if (pStrings && posStart == pos)
+				(*pStrings)[pos] = true;
+			if (posEnd >= 0)
+				posStart = -1;
+		}
+		pos++;
+	}
+
+	return vCode;
+}
+
+std::vector<bool> MapNames (const std::vector<uint8_t>& js1)
+{
+	// The same steps as Parse(), so both agree.
+	int size = js1.size();
+	std::vector<bool> vNames (size, true);
+
+	int pos = 0;
+	WCHAR quoteMark = 0;
+	int posStart = -1;
+	int posEnd = -1;
+	while (pos < size)
+	{
+		int posComment = pos;
+		if (CheckForComment (pos, js1).size())
+		{
+			for (int i = posComment; i <= pos && i < size; ++i)
+				vNames[i] = false;
+			pos++;
+			continue;
+		}
+
+		CheckForQuotedString (js1[pos], pos, posStart, posEnd, quoteMark);
+		if (posStart >= 0)
+		{
+			vNames[pos] = false;
+			if (posEnd >= 0)
+				posStart = -1;
+		}
+		pos++;
+	}
+
+	return vNames;
+}
+
+int SkipSpaceAndComments (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, int pos)
+{
+	int size = js1.size();
+	while (pos < size)
+	{
+		if (vCode[pos] && isspace (js1[pos]))
+			pos++;
+		else if (!vCode[pos] && js1[pos] == '/' && pos + 1 < size && (js1[pos + 1] == '/' || js1[pos + 1] == '*'))
+		{
+			while (pos < size && !vCode[pos])
+				pos++;
+		}
+		else
+			break;
+	}
+	return pos;
+}
+
+int PrevCodeChar (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, int pos)
+{
+	while (--pos >= 0)
+	{
+		if (vCode[pos])
+		{
+			if (!isspace (js1[pos]))
+				return js1[pos];
+			continue;
+		}
+
+		int posStart = pos;
+		while (posStart > 0 && !vCode[posStart - 1])
+			posStart--;
+		if (js1[posStart] != '/' || posStart + 1 >= (int)js1.size() || (js1[posStart + 1] != '/' && js1[posStart + 1] != '*'))
+			return js1[pos];
+		pos = posStart;
+	}
+	return 0;
+}
+
+int NextCodeChar (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, int pos, int* pPos)
+{
+	pos = SkipSpaceAndComments (js1, vCode, pos);
+	if (pos >= (int)js1.size())
+		return 0;
+	if (pPos)
+		*pPos = pos;
+	return js1[pos];
+}
+
+std::string LeadingUseStrict (const std::vector<uint8_t>& js1, int* pPos)
+{
+	int size = js1.size();
+	int pos = 0;
+	while (pos < size)
+	{
+		if (isspace (js1[pos]))
+			pos++;
+		else if (CheckForComment (pos, js1).size())
+			pos++;
+		else
+			break;
+	}
+
+	for (auto directive : { "\"use strict\"", "'use strict'" })
+	{
+		std::string s (directive);
+		if (size >= pos + (int)s.size() && std::equal (s.begin(), s.end(), js1.begin() + pos))
+		{
+			pos += s.size();
+			if (pos < size && js1[pos] == ';')
+				pos++;
+			if (pPos)
+				*pPos = pos;
+			return s;
+		}
+	}
+
+	return "";
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+// Scanning helpers shared by the passes that work on js text: what a name
+// is made of, which bytes are code, and stepping over whitespace and
+// comments given a map from MapCode().
+
+// True for the bytes a name is made of: letters, digits, '_' and '$'.
+bool IsNameChar (int c);
+
+// Flags every byte that is code, ie. not part of a quoted string, a regex
+// literal, a comment or the text of a template literal. The expressions in
+// a template's ${...} are code; the ${ and } themselves aren't. If
+// pStrings is given, it flags the opening quote of each quoted string.
+std::vector<bool> MapCode (const std::vector<uint8_t>& js1, std::vector<bool>* pStrings = nullptr);
+
+// Flags every byte where Parse() would take a name for a symbol: all but
+// quoted strings and comments. Parse() doesn't know regex or template
+// literals, so unlike MapCode() their text counts.
+std::vector<bool> MapNames (const std::vector<uint8_t>& js1);
+
+// The first position at or after pos that isn't whitespace or a comment.
+// A string or regex literal isn't skipped.
+int SkipSpaceAndComments (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, int pos);
+
+// The last char before pos that isn't whitespace or in a comment, or 0.
+int PrevCodeChar (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, int pos);
+
+// The first char at or after pos that isn't whitespace or in a comment, or
+// 0. Its position goes in *pPos.
+int NextCodeChar (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, int pos, int* pPos = nullptr);
+
+// The "use strict" directive the js opens with, after any whitespace and
+// comments, as written, eg. 'use strict', or "" if there isn't one. The
+// position just past it and its ';' goes in *pPos.
+std::string LeadingUseStrict (const std::vector<uint8_t>& js1, int* pPos = nullptr);
@@ -69,6 +69,14 @@ size_t LoadTextFileIntoMap(const std::wstring filename, std::map<std::wstring, i
     return m.size();
 }
 
+size_t LoadBinaryFile(const std::wstring filename, std::vector<uint8_t>& v)
+{
+    std::ifstream f (filename, std::ios::in | std::ios::binary);
+    v.assign ((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+
+    return v.size();
+}
+
 std::vector<std::wstring> Split(const std::wstring& line, const std::wstring& dlim)
 {
 	std::vector<std::wstring> v;
@@ -21,6 +21,7 @@ int SubstituteTextInVector (std::vector<std::wstring>& v, const std::wstring old
 void Replace(std::wstring& str, const std::wstring& oldStr, const std::wstring& newStr);
 
 size_t LoadTextFileIntoMap (const std::wstring filename, std::map<std::wstring, int>& m);
+size_t LoadBinaryFile (const std::wstring filename, std::vector<uint8_t>& v);
 
 std::vector<std::wstring> Split (const std::wstring& line, const std::wstring& dlim);
 
@@ -0,0 +1,141 @@
+#include "pch.h"
+#include "Common.h"
+#include "Compress.h"
+#include <queue>
+
+// Deflate length and distance codes: base value and number of extra bits.
+static const int lenBase[] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const int lenExtra[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const int distBase[] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const int distExtra[] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+static const int windowSize = 32768;
+static const int minMatch = 3;
+static const int maxMatch = 258;
+static const int maxChain = 64;
+
+static int CodeFor (const int* base, int count, int value)
+{
+	int code = 0;
+	while (code + 1 < count && base[code + 1] <= value)
+		code++;
+	return code;
+}
+
+static size_t HuffmanBits (const std::vector<size_t>& freq)
+{
+	// Total bits to code the symbols with an optimal prefix code (code
+	// lengths aren't capped at 15 as deflate's are; close enough here).
+	std::priority_queue<std::pair<size_t, int>, std::vector<std::pair<size_t, int>>, std::greater<std::pair<size_t, int>>> q;
+	int symbols = 0;
+	for (auto f : freq)
+	{
+		if (f)
+		{
+			q.push (std::make_pair (f, 0));
+			symbols++;
+		}
+	}
+	if (symbols == 1)
+		return q.top().first;
+
+	// Each merge adds one bit to every symbol beneath it, so the total is
+	// the sum of the merged weights.
+	size_t bits = 0;
+	while (q.size() > 1)
+	{
+		size_t a = q.top().first;
+		q.pop();
+		size_t b = q.top().first;
+		q.pop();
+		bits += a + b;
+		q.push (std::make_pair (a + b, 0));
+	}
+
+	return bits;
+}
+
+size_t EstimateDeflateSize (const std::vector<uint8_t>& v)
+{
+	std::vector<size_t> litLenFreq (286, 0);
+	std::vector<size_t> distFreq (30, 0);
+	size_t extraBits = 0;
+
+	int size = v.size();
+	std::vector<int> head (1 << 16, -1);
+	std::vector<int> prev (windowSize, -1);
+	auto hash = [&v](int pos) { return ((v[pos] << 10) ^ (v[pos + 1] << 5) ^ v[pos + 2]) & 0xFFFF; };
+	auto insert = [&](int pos)
+	{
+		if (pos + minMatch > size)
+			return;
+		int h = hash (pos);
+		prev[pos % windowSize] = head[h];
+		head[h] = pos;
+	};
+
+	int pos = 0;
+	while (pos < size)
+	{
+		// Greedy longest match in the window.
+		int bestLen = 0;
+		int bestDist = 0;
+		if (pos + minMatch <= size)
+		{
+			int candidate = head[hash (pos)];
+			for (int chain = 0; candidate >= 0 && pos - candidate <= windowSize && chain < maxChain; ++chain)
+			{
+				int len = 0;
+				int maxLen = std::min (maxMatch, size - pos);
+				while (len < maxLen && v[candidate + len] == v[pos + len])
+					len++;
+				if (len > bestLen)
+				{
+					bestLen = len;
+					bestDist = pos - candidate;
+					if (len == maxLen)
+						break;
+				}
+				int next = prev[candidate % windowSize];
+				if (next >= candidate)
+					break;
+				candidate = next;
+			}
+		}
+
+		if (bestLen >= minMatch)
+		{
+			int lc = CodeFor (lenBase, 29, bestLen);
+			int dc = CodeFor (distBase, 30, bestDist);
+			litLenFreq[257 + lc]++;
+			distFreq[dc]++;
+			extraBits += lenExtra[lc] + distExtra[dc];
+			for (int i = 0; i < bestLen; ++i)
+				insert (pos + i);
+			pos += bestLen;
+		}
+		else
+		{
+			litLenFreq[v[pos]]++;
+			insert (pos);
+			pos++;
+		}
+	}
+	litLenFreq[256]++;	// end of block
+
+	// Roughly 4 bits per code length in the block header, plus the block
+	// header itself, plus the gzip header (10) and trailer (8).
+	size_t used = 0;
+	for (auto f : litLenFreq)
+		used += f ? 1 : 0;
+	for (auto f : distFreq)
+		used += f ? 1 : 0;
+
+	size_t bits = HuffmanBits (litLenFreq) + HuffmanBits (distFreq) + extraBits + used * 4 + 17;
+
+	return (bits + 7) / 8 + 18;
+}
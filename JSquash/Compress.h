@@ -0,0 +1,12 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+// Estimates how many bytes the data would take once gzipped, without
+// actually compressing it. Runs the LZ77 match search deflate would and
+// prices the resulting symbols with Huffman codes built for them, as one
+// dynamic block plus the gzip header and trailer. It won't match any
+// particular gzip to the byte, but it moves the same way, which is all we
+// need for comparing two versions of the same output.
+size_t EstimateDeflateSize (const std::vector<uint8_t>& v);
@@ -0,0 +1,405 @@
+#include "pch.h"
+#include "Common.h"
+#include "DeadCode.h"
+#include "CodeMap.h"
+#include <cstring>
+
+static bool IsNameStart (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, int pos)
+{
+	return vCode[pos] && IsNameChar (js1[pos]) && !(js1[pos] >= '0' && js1[pos] <= '9')
+		&& (pos == 0 || !IsNameChar (js1[pos - 1]));
+}
+
+static int NameEnd (const std::vector<uint8_t>& js1, int pos)
+{
+	while (pos < (int)js1.size() && IsNameChar (js1[pos]))
+		pos++;
+	return pos;
+}
+
+static std::wstring NameAt (const std::vector<uint8_t>& js1, int pos)
+{
+	return std::wstring (js1.begin() + pos, js1.begin() + NameEnd (js1, pos));
+}
+
+static void CountNames (const std::vector<uint8_t>& js1, const std::vector<bool>& vNames, int from, int to,
+	std::map<std::wstring, int>& mRefs, int n)
+{
+	for (int pos = from; pos < to; ++pos)
+	{
+		if (IsNameStart (js1, vNames, pos))
+		{
+			int posEnd = NameEnd (js1, pos);
+			mRefs[std::wstring (js1.begin() + pos, js1.begin() + posEnd)] += n;
+			pos = posEnd - 1;
+		}
+	}
+}
+
+static std::vector<bool> MapReferences (const std::vector<uint8_t>& js1)
+{
+	// Names are counted wherever either the code or Parse() sees one. Parse()
+	// renames the text of a regex, and a quote in a regex or template sends
+	// it into a "string" that hides real code, so a symbol only counts as
+	// gone if neither view meets it.
+	std::vector<bool> vNames = MapNames (js1);
+	std::vector<bool> vCode = MapCode (js1);
+	for (size_t i = 0; i < vNames.size(); ++i)
+		vNames[i] = vNames[i] || vCode[i];
+	return vNames;
+}
+
+void CountReferences (const std::vector<uint8_t>& js1, std::map<std::wstring, int>& mRefs)
+{
+	std::vector<bool> vNames = MapReferences (js1);
+	CountNames (js1, vNames, 0, js1.size(), mRefs, 1);
+}
+
+static int MatchingBracket (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, int pos)
+{
+	// pos is on an opening bracket. Returns the position of its partner, or -1.
+	int depth = 0;
+	for (; pos < (int)js1.size(); ++pos)
+	{
+		if (!vCode[pos])
+			continue;
+		if (strchr ("([{", js1[pos]))
+			depth++;
+		else if (strchr (")]}", js1[pos]) && --depth == 0)
+			return pos;
+	}
+	return -1;
+}
+
+static bool InitialiserIsPure (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, int pos, int posEnd)
+{
+	// True if evaluating js1[pos, posEnd) can't have side effects.
+	pos = SkipSpaceAndComments (js1, vCode, pos);
+
+	// A function expression, taken whole.
+	if (pos < posEnd && NameAt (js1, pos) == L"function")
+	{
+		int posBody = pos;
+		while (posBody < posEnd && !(vCode[posBody] && js1[posBody] == '{'))
+			posBody++;
+		int posClose = posBody < posEnd ? MatchingBracket (js1, vCode, posBody) : -1;
+		return posClose >= 0 && SkipSpaceAndComments (js1, vCode, posClose + 1) >= posEnd;
+	}
+
+	// An arrow function: a name or a parameter list then "=>".
+	int posArrow = -1;
+	if (pos < posEnd && js1[pos] == '(')
+	{
+		int posClose = MatchingBracket (js1, vCode, pos);
+		if (posClose >= 0)
+			posArrow = SkipSpaceAndComments (js1, vCode, posClose + 1);
+	}
+	else if (IsNameStart (js1, vCode, pos))
+		posArrow = SkipSpaceAndComments (js1, vCode, NameEnd (js1, pos));
+	if (posArrow >= 0 && posArrow + 1 < posEnd && js1[posArrow] == '=' && js1[posArrow + 1] == '>')
+	{
+		// The body runs to the end of the initialiser; it isn't evaluated now.
+		return true;
+	}
+
+	// Otherwise literals, names and operators only.
+	for (int i = pos; i < posEnd; ++i)
+	{
+		// A template's text isn't code, so its opening backtick has to be
+		// found from the raw bytes. After a name or a bracket, eg. tag`...`,
+		// it's a call.
+		if (js1[i] == '`' && !vCode[i] && (i == 0 || vCode[i - 1]))
+		{
+			int c = PrevCodeChar (js1, vCode, i);
+			if (IsNameChar (c) || c == ')' || c == ']')
+				return false;
+		}
+		if (!vCode[i])
+			continue;
+		uint8_t c = js1[i];
+		if (c == '(' || c == '=')
+			return false;
+		if ((c == '+' || c == '-') && i + 1 < posEnd && js1[i + 1] == c)
+			return false;
+		if (IsNameStart (js1, vCode, i))
+		{
+			std::wstring word = NameAt (js1, i);
+			if (word == L"new" || word == L"delete" || word == L"await" || word == L"yield" || word == L"import")
+				return false;
+			i += word.size() - 1;
+		}
+	}
+	return true;
+}
+
+static bool ChangesQuoting (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, int from, int to)
+{
+	// Parse() doesn't know regex or template literals, so to it a quote in
+	// one opens a string. Taking such a span out would change where it
+	// thinks the strings are in the rest of the js.
+	int pos = from;
+	while (pos < to)
+	{
+		if (vCode[pos])
+		{
+			pos++;
+			continue;
+		}
+		int posRun = pos;
+		while (pos < to && !vCode[pos])
+			pos++;
+		uint8_t c = js1[posRun];
+		bool isComment = c == '/' && posRun + 1 < to && (js1[posRun + 1] == '/' || js1[posRun + 1] == '*');
+		if (c == '\'' || c == '"' || isComment)
+			continue;
+		for (int i = posRun; i < pos; ++i)
+		{
+			if (js1[i] == '\'' || js1[i] == '"')
+				return true;
+		}
+	}
+	return false;
+}
+
+// A top-level declaration or binding, and whether it can go.
+struct Binding
+{
+	std::wstring name;
+	int posStart;	// The name.
+	int posInit;	// The initialiser, if any.
+	int posEnd;		// Just past the initialiser.
+	bool dead;
+};
+
+static int ParseVarStatement (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, int pos,
+	std::vector<Binding>& vBindings)
+{
+	// pos is just past "var", "let" or "const". Returns the position of the
+	// terminating ';', or -1 if the statement is anything but a plain list of
+	// names with optional initialisers, ended by a ';'.
+	int size = js1.size();
+	for (;;)
+	{
+		pos = SkipSpaceAndComments (js1, vCode, pos);
+		if (pos >= size || !IsNameStart (js1, vCode, pos))
+			return -1;	// Includes destructuring.
+
+		Binding b;
+		b.name = NameAt (js1, pos);
+		b.posStart = pos;
+		b.dead = false;
+		pos = SkipSpaceAndComments (js1, vCode, NameEnd (js1, pos));
+		b.posInit = pos;
+
+		if (pos < size && js1[pos] == '=' && vCode[pos])
+		{
+			// The initialiser runs to the next ',' or ';' that isn't nested. A
+			// line break at that level might be an inserted ';', so give up.
+			b.posInit = ++pos;
+			int depth = 0;
+			for (; pos < size; ++pos)
+			{
+				if (!vCode[pos])
+					continue;
+				uint8_t c = js1[pos];
+				if (strchr ("([{", c))
+					depth++;
+				else if (strchr (")]}", c))
+				{
+					if (--depth < 0)
+						return -1;
+				}
+				else if (depth == 0 && (c == ',' || c == ';'))
+					break;
+				else if (depth == 0 && c == '\n')
+					return -1;
+			}
+			if (pos >= size)
+				return -1;
+		}
+
+		b.posEnd = pos;
+		while (b.posEnd > b.posStart && isspace (js1[b.posEnd - 1]))
+			b.posEnd--;
+		vBindings.push_back (b);
+
+		if (pos >= size)
+			return -1;
+		if (js1[pos] == ';')
+			return pos;
+		if (js1[pos] != ',')
+			return -1;
+		pos++;
+	}
+}
+
+// A span of the js to replace.
+struct Edit
+{
+	int posStart;
+	int posEnd;
+	std::string text;
+};
+
+static void WidenToLines (const std::vector<uint8_t>& js1, Edit& e)
+{
+	// If the span is all that's on its line(s), take the lines with it.
+	int posStart = e.posStart;
+	while (posStart > 0 && (js1[posStart - 1] == ' ' || js1[posStart - 1] == '\t'))
+		posStart--;
+	if (posStart > 0 && js1[posStart - 1] != '\n')
+		return;
+
+	int posEnd = e.posEnd;
+	while (posEnd < (int)js1.size() && (js1[posEnd] == ' ' || js1[posEnd] == '\t' || js1[posEnd] == '\r'))
+		posEnd++;
+	if (posEnd < (int)js1.size() && js1[posEnd] != '\n')
+		return;
+
+	e.posStart = posStart;
+	e.posEnd = posEnd < (int)js1.size() ? posEnd + 1 : posEnd;
+}
+
+static void KeepStatementBreak (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, Edit& e)
+{
+	// A statement that ended in '}' might run into one starting with one of
+	// these once the declaration between them has gone, so leave a ';'.
+	if (e.text.size() || PrevCodeChar (js1, vCode, e.posStart) != '}')
+		return;
+	int pos = SkipSpaceAndComments (js1, vCode, e.posEnd);
+	if (pos < (int)js1.size() && strchr ("([+-/`", js1[pos]))
+		e.text = ";";
+}
+
+bool RemoveDeadDeclarations (std::vector<uint8_t>& js1, std::map<std::wstring, int>& mRefs,
+	std::function<bool (const std::wstring&)> isRoot, DeadCodeStats& stats)
+{
+	std::vector<bool> vCode = MapCode (js1);
+	auto isDead = [&](const std::wstring& name) { return mRefs[name] == 1 && !isRoot (name); };
+
+	std::vector<Edit> vEdits;
+	std::vector<std::pair<int, int>> vRemoved;	// Spans whose names no longer count.
+	int size = js1.size();
+	int depth = 0;
+	for (int pos = 0; pos < size; ++pos)
+	{
+		if (!vCode[pos])
+			continue;
+		uint8_t c = js1[pos];
+		if (strchr ("([{", c))
+			depth++;
+		else if (strchr (")]}", c))
+			depth--;
+		if (depth != 0 || !IsNameStart (js1, vCode, pos))
+			continue;
+
+		// Only statements that start cleanly after another one.
+		std::wstring word = NameAt (js1, pos);
+		int posWordEnd = pos + word.size();
+		int prev = PrevCodeChar (js1, vCode, pos);
+		if (prev != 0 && prev != ';' && prev != '}')
+		{
+			pos = posWordEnd - 1;
+			continue;
+		}
+
+		if (word == L"function")
+		{
+			int posName = SkipSpaceAndComments (js1, vCode, posWordEnd);
+			if (posName >= size || !IsNameStart (js1, vCode, posName))
+			{
+				pos = posWordEnd - 1;
+				continue;	// Generator or anonymous.
+			}
+			std::wstring name = NameAt (js1, posName);
+			int posParams = SkipSpaceAndComments (js1, vCode, NameEnd (js1, posName));
+			int posParamsEnd = posParams < size && js1[posParams] == '(' ? MatchingBracket (js1, vCode, posParams) : -1;
+			int posBody = posParamsEnd >= 0 ? SkipSpaceAndComments (js1, vCode, posParamsEnd + 1) : size;
+			int posBodyEnd = posBody < size && js1[posBody] == '{' ? MatchingBracket (js1, vCode, posBody) : -1;
+			if (posBodyEnd < 0)
+			{
+				pos = posWordEnd - 1;
+				continue;
+			}
+
+			if (isDead (name) && !ChangesQuoting (js1, vCode, pos, posBodyEnd + 1))
+			{
+				Edit e = { pos, posBodyEnd + 1, "" };
+				vRemoved.push_back (std::make_pair (e.posStart, e.posEnd));
+				KeepStatementBreak (js1, vCode, e);
+				WidenToLines (js1, e);
+				vEdits.push_back (e);
+				stats.functions++;
+			}
+			pos = posBodyEnd;
+		}
+		else if (word == L"var" || word == L"let" || word == L"const")
+		{
+			std::vector<Binding> vBindings;
+			int posSemi = ParseVarStatement (js1, vCode, posWordEnd, vBindings);
+			if (posSemi < 0)
+			{
+				pos = posWordEnd - 1;
+				continue;
+			}
+
+			int dead = 0;
+			for (auto& b : vBindings)
+			{
+				b.dead = isDead (b.name) && InitialiserIsPure (js1, vCode, b.posInit, b.posEnd)
+					&& !ChangesQuoting (js1, vCode, b.posStart, b.posEnd);
+				if (b.dead)
+				{
+					vRemoved.push_back (std::make_pair (b.posStart, b.posEnd));
+					dead++;
+				}
+			}
+
+			if (dead == (int)vBindings.size())
+			{
+				Edit e = { pos, posSemi + 1, "" };
+				KeepStatementBreak (js1, vCode, e);
+				WidenToLines (js1, e);
+				vEdits.push_back (e);
+			}
+			else if (dead)
+			{
+				// Rebuild the statement from the bindings that are left.
+				Edit e = { pos, posSemi + 1, std::string (word.begin(), word.end()) + " " };
+				bool first = true;
+				for (auto const& b : vBindings)
+				{
+					if (b.dead)
+						continue;
+					if (!first)
+						e.text += ", ";
+					e.text.append (js1.begin() + b.posStart, js1.begin() + b.posEnd);
+					first = false;
+				}
+				e.text += ";";
+				vEdits.push_back (e);
+			}
+			stats.bindings += dead;
+			pos = posSemi;
+		}
+		else
+			pos = posWordEnd - 1;
+	}
+
+	if (vEdits.empty())
+		return false;
+
+	// The removed names no longer count, nor do any names they referred to.
+	std::vector<bool> vNames = MapReferences (js1);
+	for (auto const& r : vRemoved)
+		CountNames (js1, vNames, r.first, r.second, mRefs, -1);
+
+	for (auto it = vEdits.rbegin(); it != vEdits.rend(); ++it)
+	{
+		stats.bytes += (it->posEnd - it->posStart) - it->text.size();
+		js1.erase (js1.begin() + it->posStart, js1.begin() + it->posEnd);
+		js1.insert (js1.begin() + it->posStart, it->text.begin(), it->text.end());
+	}
+
+	return true;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <vector>
+#include <map>
+#include <string>
+#include <functional>
+#include <cstdint>
+
+// Unused top-level declaration elimination.
+//
+// Drops "function name() {...}" declarations and var/let/const bindings at
+// the top level of the js whose name occurs nowhere but in its own
+// declaration. mRefs counts every occurrence of each identifier (over all
+// files in a bundle) wherever Parse() would rename it, regex literals
+// included, and is kept up to date as declarations go, so helpers only
+// used by dead helpers go too on a later sweep. isRoot() names what must
+// be kept regardless, eg. the ignore list.
+//
+// Only bindings whose initialiser can't have side effects are dropped:
+// literals, function expressions, and object/array literals and
+// expressions made of those without calls, assignments or "new".
+struct DeadCodeStats
+{
+	int functions = 0;
+	int bindings = 0;
+	size_t bytes = 0;
+};
+
+// Adds the number of times each identifier occurs in the js to mRefs.
+void CountReferences (const std::vector<uint8_t>& js1, std::map<std::wstring, int>& mRefs);
+
+// One sweep over the js. Returns true if anything was removed.
+bool RemoveDeadDeclarations (std::vector<uint8_t>& js1, std::map<std::wstring, int>& mRefs,
+	std::function<bool (const std::wstring&)> isRoot, DeadCodeStats& stats);
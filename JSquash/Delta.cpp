@@ -0,0 +1,191 @@
+#include "pch.h"
+#include "Common.h"
+#include "Delta.h"
+#include <unordered_map>
+
+static uint32_t Adler32 (const std::vector<uint8_t>& v)
+{
+	uint32_t a = 1;
+	uint32_t b = 0;
+	for (auto c : v)
+	{
+		a = (a + c) % 65521;
+		b = (b + a) % 65521;
+	}
+	return (b << 16) | a;
+}
+
+static void PutVarint (std::vector<uint8_t>& v, uint64_t n)
+{
+	while (n >= 0x80)
+	{
+		v.push_back ((uint8_t)(n | 0x80));
+		n >>= 7;
+	}
+	v.push_back ((uint8_t)n);
+}
+
+static bool GetVarint (const std::vector<uint8_t>& v, size_t& pos, uint64_t& n)
+{
+	n = 0;
+	for (int shift = 0; shift < 64; shift += 7)
+	{
+		if (pos >= v.size())
+			return false;
+		uint8_t c = v[pos++];
+		n |= (uint64_t)(c & 0x7F) << shift;
+		if (!(c & 0x80))
+			return true;
+	}
+	return false;
+}
+
+static void Put32 (std::vector<uint8_t>& v, uint32_t n)
+{
+	for (int i = 0; i < 4; ++i)
+		v.push_back ((uint8_t)(n >> (i * 8)));
+}
+
+static bool Get32 (const std::vector<uint8_t>& v, size_t& pos, uint32_t& n)
+{
+	if (pos + 4 > v.size())
+		return false;
+	n = 0;
+	for (int i = 0; i < 4; ++i)
+		n |= (uint32_t)v[pos++] << (i * 8);
+	return true;
+}
+
+// Rolling hash over a window of deltaBlockSize bytes: the sum of
+// c[i] * hashBase^(deltaBlockSize - 1 - i), mod 2^32.
+static const uint32_t hashBase = 257;
+
+static uint32_t HashBlock (const uint8_t* p)
+{
+	uint32_t h = 0;
+	for (int i = 0; i < deltaBlockSize; ++i)
+		h = h * hashBase + p[i];
+	return h;
+}
+
+static void PutAdd (std::vector<uint8_t>& delta, const std::vector<uint8_t>& vNew, size_t from, size_t to)
+{
+	if (to <= from)
+		return;
+	PutVarint (delta, ((uint64_t)(to - from) << 1) | 1);
+	delta.insert (delta.end(), vNew.begin() + from, vNew.begin() + to);
+}
+
+void MakeDelta (const std::vector<uint8_t>& vOld, const std::vector<uint8_t>& vNew, std::vector<uint8_t>& delta)
+{
+	delta.clear();
+	delta.insert (delta.end(), { 'J', 'S', 'Q', 'D', 1 });
+	PutVarint (delta, vOld.size());
+	PutVarint (delta, vNew.size());
+	Put32 (delta, Adler32 (vOld));
+	Put32 (delta, Adler32 (vNew));
+
+	// Index the old version's blocks. The first occurrence of a hash wins.
+	std::unordered_map<uint32_t, size_t> mBlocks;
+	mBlocks.reserve (vOld.size() / deltaBlockSize + 1);
+	for (size_t pos = 0; pos + deltaBlockSize <= vOld.size(); pos += deltaBlockSize)
+		mBlocks.emplace (HashBlock (&vOld[pos]), pos);
+
+	// hashBase^(deltaBlockSize - 1), to roll the outgoing byte off.
+	uint32_t topPower = 1;
+	for (int i = 1; i < deltaBlockSize; ++i)
+		topPower *= hashBase;
+
+	size_t posAdd = 0;	// Start of the literal run not yet written.
+	size_t pos = 0;
+	uint32_t h = vNew.size() >= deltaBlockSize ? HashBlock (&vNew[0]) : 0;
+	while (pos + deltaBlockSize <= vNew.size())
+	{
+		auto it = mBlocks.find (h);
+		if (it != mBlocks.end() && std::equal (vNew.begin() + pos, vNew.begin() + pos + deltaBlockSize, vOld.begin() + it->second))
+		{
+			// Extend the match forwards, then backwards into the pending literals.
+			size_t posOld = it->second;
+			size_t len = deltaBlockSize;
+			while (pos + len < vNew.size() && posOld + len < vOld.size() && vNew[pos + len] == vOld[posOld + len])
+				len++;
+			while (pos > posAdd && posOld > 0 && vNew[pos - 1] == vOld[posOld - 1])
+			{
+				pos--;
+				posOld--;
+				len++;
+			}
+
+			PutAdd (delta, vNew, posAdd, pos);
+			PutVarint (delta, (uint64_t)len << 1);
+			PutVarint (delta, posOld);
+
+			pos += len;
+			posAdd = pos;
+			if (pos + deltaBlockSize <= vNew.size())
+				h = HashBlock (&vNew[pos]);
+			continue;
+		}
+
+		if (pos + deltaBlockSize < vNew.size())
+			h = (h - vNew[pos] * topPower) * hashBase + vNew[pos + deltaBlockSize];
+		pos++;
+	}
+
+	PutAdd (delta, vNew, posAdd, vNew.size());
+}
+
+bool ApplyDelta (const std::vector<uint8_t>& vOld, const std::vector<uint8_t>& delta, std::vector<uint8_t>& vNew)
+{
+	vNew.clear();
+	size_t pos = 0;
+	if (delta.size() < 5 || delta[0] != 'J' || delta[1] != 'S' || delta[2] != 'Q' || delta[3] != 'D' || delta[4] != 1)
+		return false;
+	pos = 5;
+
+	uint64_t oldSize = 0;
+	uint64_t newSize = 0;
+	uint32_t oldSum = 0;
+	uint32_t newSum = 0;
+	if (!GetVarint (delta, pos, oldSize) || !GetVarint (delta, pos, newSize)
+		|| !Get32 (delta, pos, oldSum) || !Get32 (delta, pos, newSum))
+		return false;
+	if (oldSize != vOld.size() || oldSum != Adler32 (vOld))
+		return false;
+
+	// newSize is only as good as the header. Each copy takes at least two
+	// bytes of the delta and brings at most all of vOld, so anything beyond
+	// that is corrupt. Nor is more reserved than vOld and the delta hold, as
+	// that's what a delta of fresh content comes to; vNew grows if need be.
+	uint64_t rest = delta.size() - pos;
+	if (newSize > rest / 2 * vOld.size() + rest)
+		return false;
+	vNew.reserve ((size_t)std::min<uint64_t> (newSize, vOld.size() + rest));
+	while (vNew.size() < newSize)
+	{
+		uint64_t n = 0;
+		if (!GetVarint (delta, pos, n))
+			return false;
+
+		uint64_t len = n >> 1;
+		if (len == 0 || vNew.size() + len > newSize)
+			return false;
+
+		if (n & 1)
+		{
+			if (pos + len > delta.size())
+				return false;
+			vNew.insert (vNew.end(), delta.begin() + pos, delta.begin() + pos + len);
+			pos += len;
+		}
+		else
+		{
+			uint64_t posOld = 0;
+			if (!GetVarint (delta, pos, posOld) || posOld + len > vOld.size())
+				return false;
+			vNew.insert (vNew.end(), vOld.begin() + posOld, vOld.begin() + posOld + len);
+		}
+	}
+
+	return pos == delta.size() && Adler32 (vNew) == newSum;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+// Binary delta between two versions of a file, so a client holding the old
+// version can fetch a small patch instead of the whole new version.
+//
+// Format:
+//
+//	"JSQD" 1					magic, version
+//	<old size> <new size>		varints
+//	<old adler32> <new adler32>	4 bytes each, little endian
+//	ops...						until new size bytes are produced
+//
+// where each op is a varint n: if bit 0 is clear, copy n >> 1 bytes from
+// the old version at the varint offset that follows; if set, add the
+// n >> 1 literal bytes that follow.
+//
+// The old version is indexed in blocks of deltaBlockSize bytes by a rolling
+// hash; the new version is scanned with the same hash a byte at a time, and
+// every hit is verified and extended both ways. It's linear in the size of
+// the two files.
+
+const int deltaBlockSize = 16;
+
+void MakeDelta (const std::vector<uint8_t>& vOld, const std::vector<uint8_t>& vNew, std::vector<uint8_t>& delta);
+
+// Rebuilds the new version. Returns false if the delta is corrupt or was
+// made against a different old version.
+bool ApplyDelta (const std::vector<uint8_t>& vOld, const std::vector<uint8_t>& delta, std::vector<uint8_t>& vNew);
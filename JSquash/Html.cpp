@@ -0,0 +1,183 @@
+#include "pch.h"
+#include "Common.h"
+#include "Html.h"
+#include <cstring>
+
+static bool MatchNoCase (const std::vector<uint8_t>& html, size_t pos, const char* s)
+{
+	size_t len = strlen (s);
+	if (pos + len > html.size())
+		return false;
+	for (size_t i = 0; i < len; ++i)
+	{
+		if (tolower (html[pos + i]) != s[i])
+			return false;
+	}
+	return true;
+}
+
+static size_t FindNoCase (const std::vector<uint8_t>& html, size_t pos, const char* s)
+{
+	// Position of s (lower case) at or after pos, or html.size().
+	for (; pos < html.size(); ++pos)
+	{
+		if (MatchNoCase (html, pos, s))
+			return pos;
+	}
+	return html.size();
+}
+
+static bool IsJsType (std::string type)
+{
+	// An empty type, or a JavaScript MIME type, possibly with parameters.
+	size_t posParams = type.find (';');
+	if (posParams != std::string::npos)
+		type.erase (posParams);
+	while (type.size() && isspace ((uint8_t)type.back()))
+		type.pop_back();
+	while (type.size() && isspace ((uint8_t)type[0]))
+		type.erase (0, 1);
+
+	const char* const jsTypes[] = {
+		"", "module", "text/javascript", "application/javascript", "text/ecmascript",
+		"application/ecmascript", "application/x-javascript", "text/jscript"
+	};
+	for (auto t : jsTypes)
+	{
+		if (type == t)
+			return true;
+	}
+	return false;
+}
+
+static size_t ParseTag (const std::vector<uint8_t>& html, size_t pos, bool& isJs, std::vector<ScriptBlock>& vHandlers)
+{
+	// pos is just past the tag name. Reads the attributes, noting any js in
+	// them, and returns the position just past the closing '>', or
+	// html.size(). isJs is for a <script> tag.
+	isJs = true;
+	size_t size = html.size();
+	while (pos < size)
+	{
+		while (pos < size && (isspace (html[pos]) || html[pos] == '/'))
+			pos++;
+		if (pos >= size)
+			break;
+		if (html[pos] == '>')
+			return pos + 1;
+
+		std::string name;
+		while (pos < size && !isspace (html[pos]) && html[pos] != '=' && html[pos] != '>' && html[pos] != '/')
+			name += (char)tolower (html[pos++]);
+
+		std::string value;
+		size_t posValue = pos;
+		size_t posValueEnd = pos;
+		while (pos < size && isspace (html[pos]))
+			pos++;
+		if (pos < size && html[pos] == '=')
+		{
+			pos++;
+			while (pos < size && isspace (html[pos]))
+				pos++;
+			if (pos < size && (html[pos] == '"' || html[pos] == '\''))
+			{
+				uint8_t quote = html[pos++];
+				posValue = pos;
+				while (pos < size && html[pos] != quote)
+					value += (char)tolower (html[pos++]);
+				posValueEnd = pos;
+				pos++;
+			}
+			else
+			{
+				posValue = pos;
+				while (pos < size && !isspace (html[pos]) && html[pos] != '>')
+					value += (char)tolower (html[pos++]);
+				posValueEnd = pos;
+			}
+		}
+
+		if (name == "src")
+			isJs = false;
+		else if (name == "type" && !IsJsType (value))
+			isJs = false;
+
+		if (name.size() > 2 && name.compare (0, 2, "on") == 0 && posValueEnd > posValue)
+		{
+			ScriptBlock b = { posValue, posValueEnd };
+			vHandlers.push_back (b);
+		}
+		size_t posJs = value.find_first_not_of (" \t\r\n");
+		if (posJs != std::string::npos && value.compare (posJs, 11, "javascript:") == 0)
+		{
+			ScriptBlock b = { posValue + posJs + 11, posValueEnd };
+			vHandlers.push_back (b);
+		}
+	}
+	return size;
+}
+
+static void ScanPage (const std::vector<uint8_t>& html, std::vector<ScriptBlock>& vBlocks, std::vector<ScriptBlock>& vHandlers)
+{
+	size_t size = html.size();
+	size_t pos = 0;
+	while (pos < size)
+	{
+		if (html[pos] != '<')
+		{
+			pos++;
+			continue;
+		}
+
+		if (MatchNoCase (html, pos, "<!--"))
+		{
+			size_t posEnd = FindNoCase (html, pos + 4, "-->");
+			pos = posEnd < size ? posEnd + 3 : size;
+			continue;
+		}
+
+		if (MatchNoCase (html, pos, "<script") && pos + 7 < size
+			&& (isspace (html[pos + 7]) || html[pos + 7] == '>' || html[pos + 7] == '/'))
+		{
+			bool isJs;
+			size_t posStart = ParseTag (html, pos + 7, isJs, vHandlers);
+			size_t posEnd = FindNoCase (html, posStart, "</script");
+			if (isJs && posEnd > posStart && posEnd < size)
+			{
+				ScriptBlock b = { posStart, posEnd };
+				vBlocks.push_back (b);
+			}
+			pos = posEnd;
+			continue;
+		}
+
+		if (pos + 1 < size && isalpha (html[pos + 1]))
+		{
+			size_t posName = pos + 1;
+			while (posName < size && !isspace (html[posName]) && html[posName] != '>' && html[posName] != '/')
+				posName++;
+			bool isJs;
+			pos = ParseTag (html, posName, isJs, vHandlers);
+			continue;
+		}
+
+		pos++;
+	}
+}
+
+std::vector<ScriptBlock> FindScriptBlocks (const std::vector<uint8_t>& html)
+{
+	std::vector<ScriptBlock> vBlocks;
+	std::vector<ScriptBlock> vHandlers;
+	ScanPage (html, vBlocks, vHandlers);
+	return vBlocks;
+}
+
+std::vector<ScriptBlock> FindInlineHandlers (const std::vector<uint8_t>& html)
+{
+	std::vector<ScriptBlock> vBlocks;
+	std::vector<ScriptBlock> vHandlers;
+	ScanPage (html, vBlocks, vHandlers);
+	return vHandlers;
+}
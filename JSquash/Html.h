@@ -0,0 +1,27 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+// Inline scripts in an HTML page.
+//
+// The page is scanned once, front to back. A <script> element is taken if
+// it has no src attribute and either no type or a JavaScript one
+// (text/javascript, module, ...); its contents run up to the first
+// "</script", as a browser would see it. HTML comments are skipped.
+// Everything outside the blocks is left as it is.
+
+// A block's contents: bytes [posStart, posEnd) of the page.
+struct ScriptBlock
+{
+	size_t posStart;
+	size_t posEnd;
+};
+
+std::vector<ScriptBlock> FindScriptBlocks (const std::vector<uint8_t>& html);
+
+// The js the page runs outside the blocks: the values of on* event handler
+// attributes, eg. onclick="save()", and what follows "javascript:" in an
+// attribute, eg. href="javascript:go(1)". They're left as they are, but the
+// names in them are the scripts' too.
+std::vector<ScriptBlock> FindInlineHandlers (const std::vector<uint8_t>& html);
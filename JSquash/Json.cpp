@@ -0,0 +1,327 @@
+#include "pch.h"
+#include "Common.h"
+#include "Json.h"
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define JSON_SSE2
+#endif
+
+static bool IsJsonSpace (uint8_t c)
+{
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+void MinifyJson (const std::vector<uint8_t>& js, std::vector<uint8_t>& jsNew)
+{
+	// The output is never longer than the input, so write straight into a
+	// buffer of that size and trim it at the end.
+	size_t size = js.size();
+	jsNew.resize (size);
+	const uint8_t* src = js.data();
+	uint8_t* dst = jsNew.data();
+
+	bool inString = false;
+	bool escaped = false;
+	size_t pos = 0;
+
+	// Copies one byte of a block that needs looking at closely.
+	auto scalar = [&](uint8_t c)
+	{
+		if (inString)
+		{
+			*dst++ = c;
+			if (escaped)
+				escaped = false;
+			else if (c == '\\')
+				escaped = true;
+			else if (c == '"')
+				inString = false;
+		}
+		else if (!IsJsonSpace (c))
+		{
+			*dst++ = c;
+			inString = c == '"';
+		}
+	};
+
+#ifdef JSON_SSE2
+	const __m128i quote = _mm_set1_epi8 ('"');
+	const __m128i backslash = _mm_set1_epi8 ('\\');
+	const __m128i space = _mm_set1_epi8 (' ');
+	const __m128i tab = _mm_set1_epi8 ('\t');
+	const __m128i lf = _mm_set1_epi8 ('\n');
+	const __m128i cr = _mm_set1_epi8 ('\r');
+
+	for (; pos + 16 <= size; pos += 16)
+	{
+		__m128i v = _mm_loadu_si128 ((const __m128i*)(src + pos));
+		int special = _mm_movemask_epi8 (_mm_or_si128 (_mm_cmpeq_epi8 (v, quote), _mm_cmpeq_epi8 (v, backslash)));
+		if (special == 0 && !escaped)
+		{
+			if (inString)
+			{
+				_mm_storeu_si128 ((__m128i*)dst, v);
+				dst += 16;
+				continue;
+			}
+
+			__m128i ws = _mm_or_si128 (_mm_or_si128 (_mm_cmpeq_epi8 (v, space), _mm_cmpeq_epi8 (v, tab)),
+				_mm_or_si128 (_mm_cmpeq_epi8 (v, lf), _mm_cmpeq_epi8 (v, cr)));
+			int wsMask = _mm_movemask_epi8 (ws);
+			if (wsMask == 0)
+			{
+				_mm_storeu_si128 ((__m128i*)dst, v);
+				dst += 16;
+			}
+			else if (wsMask != 0xFFFF)
+			{
+				// Squeeze out the whitespace: every byte is written, but dst
+				// only moves on past the ones we keep.
+				for (int i = 0; i < 16; ++i)
+				{
+					*dst = src[pos + i];
+					dst += ((wsMask >> i) & 1) ^ 1;
+				}
+			}
+			continue;
+		}
+
+		for (int i = 0; i < 16; ++i)
+			scalar (src[pos + i]);
+	}
+#endif
+
+	for (; pos < size; ++pos)
+		scalar (src[pos]);
+
+	jsNew.resize (dst - jsNew.data());
+}
+
+//-----------------------------------------------------------------------------
+// Validation
+
+static size_t SkipJsonSpace (const std::vector<uint8_t>& js, size_t pos)
+{
+	while (pos < js.size() && IsJsonSpace (js[pos]))
+		pos++;
+	return pos;
+}
+
+static bool IsHexDigit (uint8_t c)
+{
+	return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+static bool ScanJsonString (const std::vector<uint8_t>& js, size_t& pos, std::string& error)
+{
+	// pos is on the opening quote; leaves it just past the closing one.
+	size_t size = js.size();
+	for (pos++; pos < size; ++pos)
+	{
+		uint8_t c = js[pos];
+		if (c == '"')
+		{
+			pos++;
+			return true;
+		}
+		if (c < 0x20)
+		{
+			error = "control character in string";
+			return false;
+		}
+		if (c == '\\')
+		{
+			if (++pos >= size)
+				break;
+			c = js[pos];
+			if (c == 'u')
+			{
+				for (int i = 0; i < 4; ++i)
+				{
+					if (++pos >= size || !IsHexDigit (js[pos]))
+					{
+						error = "bad \\u escape";
+						return false;
+					}
+				}
+			}
+			else if (!strchr ("\"\\/bfnrt", c))
+			{
+				error = "bad escape";
+				return false;
+			}
+		}
+	}
+	error = "unterminated string";
+	return false;
+}
+
+static bool ScanJsonNumber (const std::vector<uint8_t>& js, size_t& pos, std::string& error)
+{
+	// -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+	size_t size = js.size();
+	auto digits = [&]()
+	{
+		size_t posStart = pos;
+		while (pos < size && js[pos] >= '0' && js[pos] <= '9')
+			pos++;
+		return pos > posStart;
+	};
+
+	if (js[pos] == '-')
+		pos++;
+	if (pos < size && js[pos] == '0')
+		pos++;
+	else if (!digits())
+	{
+		error = "bad number";
+		return false;
+	}
+	if (pos < size && js[pos] == '.')
+	{
+		pos++;
+		if (!digits())
+		{
+			error = "bad fraction";
+			return false;
+		}
+	}
+	if (pos < size && (js[pos] == 'e' || js[pos] == 'E'))
+	{
+		pos++;
+		if (pos < size && (js[pos] == '+' || js[pos] == '-'))
+			pos++;
+		if (!digits())
+		{
+			error = "bad exponent";
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool ScanJsonKey (const std::vector<uint8_t>& js, size_t& pos, std::string& error)
+{
+	// A member name and its ':'. pos is at the start of the name.
+	if (pos >= js.size() || js[pos] != '"')
+	{
+		error = "member name expected";
+		return false;
+	}
+	if (!ScanJsonString (js, pos, error))
+		return false;
+	pos = SkipJsonSpace (js, pos);
+	if (pos >= js.size() || js[pos] != ':')
+	{
+		error = "':' expected";
+		return false;
+	}
+	pos++;
+	return true;
+}
+
+bool ValidateJson (const std::vector<uint8_t>& js, size_t& posError, std::string& error)
+{
+	// Iterative, so the depth of nesting is only limited by memory.
+	std::vector<uint8_t> vOpen;		// '{' or '[' for each container we're in.
+	size_t size = js.size();
+	size_t pos = SkipJsonSpace (js, 0);
+	bool expectValue = true;
+
+	for (;;)
+	{
+		pos = SkipJsonSpace (js, pos);
+		if (pos >= size)
+		{
+			if (expectValue || vOpen.size())
+			{
+				error = "unexpected end";
+				break;
+			}
+			return true;
+		}
+
+		uint8_t c = js[pos];
+		if (expectValue)
+		{
+			if (c == '{' || c == '[')
+			{
+				// An empty container is a complete value; otherwise a member
+				// or element comes next.
+				pos = SkipJsonSpace (js, pos + 1);
+				if (pos < size && js[pos] == (c == '{' ? '}' : ']'))
+				{
+					pos++;
+					expectValue = false;
+					continue;
+				}
+				vOpen.push_back (c);
+				if (c == '{' && !ScanJsonKey (js, pos, error))
+					break;
+				continue;
+			}
+
+			if (c == '"')
+			{
+				if (!ScanJsonString (js, pos, error))
+					break;
+			}
+			else if (c == '-' || (c >= '0' && c <= '9'))
+			{
+				if (!ScanJsonNumber (js, pos, error))
+					break;
+			}
+			else
+			{
+				bool found = false;
+				for (auto word : { "true", "false", "null" })
+				{
+					size_t len = strlen (word);
+					if (pos + len <= size && std::equal (word, word + len, js.begin() + pos))
+					{
+						pos += len;
+						found = true;
+						break;
+					}
+				}
+				if (!found)
+				{
+					error = "value expected";
+					break;
+				}
+			}
+			expectValue = false;
+			continue;
+		}
+
+		// After a value: a separator, the end of the container, or nothing
+		// at all if it was the top-level value.
+		if (vOpen.empty())
+		{
+			error = "unexpected data after the end";
+			break;
+		}
+		if (c == ',')
+		{
+			pos = SkipJsonSpace (js, pos + 1);
+			if (vOpen.back() == '{' && !ScanJsonKey (js, pos, error))
+				break;
+			expectValue = true;
+		}
+		else if (c == (vOpen.back() == '{' ? '}' : ']'))
+		{
+			vOpen.pop_back();
+			pos++;
+		}
+		else
+		{
+			error = vOpen.back() == '{' ? "',' or '}' expected" : "',' or ']' expected";
+			break;
+		}
+	}
+
+	posError = pos;
+	return false;
+}
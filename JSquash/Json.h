@@ -0,0 +1,22 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+// JSON minification: no symbols, no comments, just the whitespace between
+// tokens to go.
+//
+// The input is scanned 16 bytes at a time with SSE2 where available: a
+// block with no '"' or '\\' in it is either copied whole (inside a string,
+// or outside one with no whitespace) or has its whitespace bytes squeezed
+// out; only blocks with string boundaries or escapes go a byte at a time.
+// The output is the same however the input divides into blocks.
+
+// Writes js with the insignificant whitespace removed to jsNew. Doesn't
+// check the input is valid JSON; if it isn't, the output is no worse.
+void MinifyJson (const std::vector<uint8_t>& js, std::vector<uint8_t>& jsNew);
+
+// Checks js is one well-formed JSON value (RFC 8259). If not, returns false
+// with the byte offset of the problem and what it is.
+bool ValidateJson (const std::vector<uint8_t>& js, size_t& posError, std::string& error);
@@ -0,0 +1,485 @@
+#include "pch.h"
+#include "Common.h"
+#include "Peephole.h"
+#include "CodeMap.h"
+#include <cstring>
+
+std::atomic<int> literalSaved[LitRuleCount];
+
+static bool IsDigit (int c)
+{
+	return c >= '0' && c <= '9';
+}
+
+//-----------------------------------------------------------------------------
+// Literal shortening
+
+static int ScanNumber (const std::vector<uint8_t>& js1, int pos)
+{
+	// Returns the position just past the numeric literal starting at pos.
+	int size = js1.size();
+	if (js1[pos] == '0' && pos + 1 < size && isalpha (js1[pos + 1]))
+	{
+		pos += 2;
+		while (pos < size && isxdigit (js1[pos]))
+			pos++;
+		return pos;
+	}
+
+	while (pos < size && IsDigit (js1[pos]))
+		pos++;
+	if (pos < size && js1[pos] == '.')
+	{
+		pos++;
+		while (pos < size && IsDigit (js1[pos]))
+			pos++;
+	}
+	if (pos < size && (js1[pos] == 'e' || js1[pos] == 'E'))
+	{
+		int pos1 = pos + 1;
+		if (pos1 < size && (js1[pos1] == '+' || js1[pos1] == '-'))
+			pos1++;
+		if (pos1 < size && IsDigit (js1[pos1]))
+		{
+			pos = pos1;
+			while (pos < size && IsDigit (js1[pos]))
+				pos++;
+		}
+	}
+
+	return pos;
+}
+
+static std::string ExponentForm (const std::string& digits)
+{
+	// 1000000 -> 1e6. digits is a decimal integer without leading zeros.
+	size_t zeros = 0;
+	while (zeros < digits.size() - 1 && digits[digits.size() - 1 - zeros] == '0')
+		zeros++;
+	if (zeros == 0)
+		return digits;
+
+	return digits.substr (0, digits.size() - zeros) + "e" + std::to_string (zeros);
+}
+
+static int ShortenNumber (const std::string& token, int rules, std::string& shorter)
+{
+	// Finds the shortest equivalent spelling of a numeric literal that the
+	// enabled rules allow. Returns the rule responsible, or -1 if none.
+	std::vector<std::pair<std::string, int>> vCandidates;
+	bool isHex = token.size() > 2 && token[0] == '0' && (token[1] == 'x' || token[1] == 'X');
+
+	// Leave legacy octal (010), binary and octal literals well alone.
+	if (token.size() > 1 && token[0] == '0' && (IsDigit (token[1]) || (isalpha (token[1]) && !isHex)))
+		return -1;
+
+	if (isHex)
+	{
+		// Only values an IEEE double holds exactly.
+		if (token.size() > 2 + 13)
+			return -1;
+		std::string dec = std::to_string (std::stoull (token.substr (2), nullptr, 16));
+		if (rules & (1 << LitHex))
+		{
+			vCandidates.push_back (std::make_pair (dec, (int)LitHex));
+			if (rules & (1 << LitExponent))
+				vCandidates.push_back (std::make_pair (ExponentForm (dec), (int)LitHex));
+		}
+	}
+	else if (token.find_first_not_of ("0123456789") == std::string::npos)
+	{
+		if (token.size() > 15)
+			return -1;
+		if (rules & (1 << LitExponent))
+			vCandidates.push_back (std::make_pair (ExponentForm (token), (int)LitExponent));
+		if (rules & (1 << LitHex))
+		{
+			std::ostringstream hex;
+			hex << "0x" << std::hex << std::stoull (token);
+			vCandidates.push_back (std::make_pair (hex.str(), (int)LitHex));
+		}
+	}
+	else
+	{
+		// Decimal fraction and/or exponent.
+		size_t posExp = token.find_first_of ("eE");
+		std::string mantissa = token.substr (0, posExp);
+		std::string exponent = posExp == std::string::npos ? "" : token.substr (posExp);
+		size_t posDot = mantissa.find ('.');
+		std::string intPart = mantissa.substr (0, posDot);
+		std::string fracPart = posDot == std::string::npos ? "" : mantissa.substr (posDot + 1);
+
+		while (intPart.size() && intPart[0] == '0')
+			intPart.erase (0, 1);
+		while (fracPart.size() && fracPart.back() == '0')
+			fracPart.pop_back();
+
+		if (rules & (1 << LitFraction))
+		{
+			std::string s = fracPart.size() ? intPart + "." + fracPart : (intPart.size() ? intPart : "0");
+			vCandidates.push_back (std::make_pair (s + exponent, (int)LitFraction));
+		}
+
+		// 0.001 -> 1e-3
+		if ((rules & (1 << LitExponent)) && intPart.empty() && exponent.empty() && fracPart.size())
+		{
+			size_t zeros = fracPart.find_first_not_of ('0');
+			std::string digits = fracPart.substr (zeros);
+			vCandidates.push_back (std::make_pair (digits + "e-" + std::to_string (fracPart.size()), (int)LitExponent));
+		}
+	}
+
+	int rule = -1;
+	shorter = token;
+	for (auto const& c : vCandidates)
+	{
+		if (c.first.size() < shorter.size())
+		{
+			shorter = c.first;
+			rule = c.second;
+		}
+	}
+
+	return rule;
+}
+
+static bool UndefinedIsShadowed (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode)
+{
+	// True if anything declares or assigns "undefined": var/let/const,
+	// function or catch parameters, or a plain "undefined = ...".
+	int size = js1.size();
+	std::string prevWord;
+	bool expectParams = false;
+	int parenDepth = 0;
+	int paramsDepth = -1;
+
+	int pos = 0;
+	while (pos < size)
+	{
+		uint8_t c = js1[pos];
+		if (!vCode[pos])
+		{
+			pos++;
+			continue;
+		}
+
+		if (c == '(')
+		{
+			parenDepth++;
+			if (expectParams)
+				paramsDepth = parenDepth;
+			expectParams = false;
+		}
+		else if (c == ')')
+		{
+			if (parenDepth == paramsDepth)
+				paramsDepth = -1;
+			parenDepth--;
+		}
+
+		if (!IsNameChar (c) || IsDigit (c))
+		{
+			pos++;
+			continue;
+		}
+
+		int posEnd = pos;
+		while (posEnd < size && IsNameChar (js1[posEnd]))
+			posEnd++;
+		std::string word (js1.begin() + pos, js1.begin() + posEnd);
+
+		if (word == "undefined")
+		{
+			if (prevWord == "var" || prevWord == "let" || prevWord == "const" || prevWord == "function" || paramsDepth > 0)
+				return true;
+
+			int posNext = 0;
+			if (NextCodeChar (js1, vCode, posEnd, &posNext) == '=' && posNext + 1 < size && js1[posNext + 1] != '=' && js1[posNext + 1] != '>')
+				return true;
+		}
+
+		if (word == "function" || word == "catch")
+			expectParams = true;
+
+		prevWord = word;
+		pos = posEnd;
+	}
+
+	return false;
+}
+
+static bool ValueCanBeReplaced (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, int pos, int posEnd, bool inBraces)
+{
+	// Can the value keyword at pos be swapped for a unary expression like
+	// "!0" or "void 0"? Not if it's a property name (x.true, {true:1}), a
+	// shorthand property ({undefined}), or an operand that binds tighter
+	// than a unary operator (true.toString(), undefined[x], true?.x, true ** 2).
+	int prev = PrevCodeChar (js1, vCode, pos);
+	int posNext = posEnd;
+	int next = NextCodeChar (js1, vCode, posEnd, &posNext);
+	int next2 = posNext + 1 < (int)js1.size() ? js1[posNext + 1] : 0;
+
+	if (prev == '.' || next == '.' || next == '[' || next == '(')
+		return false;
+	if (next == '?' && next2 == '.')
+		return false;
+	if (next == ':' && prev != '?')
+		return false;
+	if (next == '=' && next2 != '=')
+		return false;
+	if (next == '*' && next2 == '*')
+		return false;
+	if (inBraces && (prev == '{' || prev == ',') && (next == '}' || next == ','))
+		return false;
+
+	return true;
+}
+
+void ShortenLiterals (std::vector<uint8_t>& js1, int rules)
+{
+	std::vector<bool> vCode = MapCode (js1);
+	bool undefinedOk = (rules & (1 << LitUndefined)) && !UndefinedIsShadowed (js1, vCode);
+	std::vector<char> vBrackets;	// Open brackets, innermost last.
+
+	std::vector<uint8_t> js2;
+	int size = js1.size();
+	int pos = 0;
+	while (pos < size)
+	{
+		uint8_t c = js1[pos];
+		bool prevIsNameChar = pos > 0 && vCode[pos - 1] && IsNameChar (js1[pos - 1]);
+		if (!vCode[pos] || prevIsNameChar || !(IsNameChar (c) || (c == '.' && pos + 1 < size && IsDigit (js1[pos + 1]))))
+		{
+			if (vCode[pos])
+			{
+				if (c == '(' || c == '[' || c == '{')
+					vBrackets.push_back (c);
+				else if ((c == ')' || c == ']' || c == '}') && vBrackets.size())
+					vBrackets.pop_back();
+			}
+			js2.push_back (c);
+			pos++;
+			continue;
+		}
+
+		std::string repl;
+		int rule = -1;
+		int posEnd = pos;
+		if (IsDigit (c) || c == '.')
+		{
+			// Numeric literal. Not if it runs into a name (BigInt 10n, 1_000)
+			// or a member access (1.0.toFixed()).
+			posEnd = ScanNumber (js1, pos);
+			std::string token (js1.begin() + pos, js1.begin() + posEnd);
+			if (posEnd < size && (IsNameChar (js1[posEnd]) || js1[posEnd] == '.'))
+				rule = -1;
+			else
+				rule = ShortenNumber (token, rules, repl);
+		}
+		else
+		{
+			while (posEnd < size && IsNameChar (js1[posEnd]))
+				posEnd++;
+			std::string word (js1.begin() + pos, js1.begin() + posEnd);
+			bool inBraces = vBrackets.size() && vBrackets.back() == '{';
+
+			if ((rules & (1 << LitBoolean)) && (word == "true" || word == "false"))
+			{
+				rule = LitBoolean;
+				repl = word == "true" ? "!0" : "!1";
+			}
+			else if (undefinedOk && word == "undefined")
+			{
+				rule = LitUndefined;
+				repl = "void 0";
+			}
+
+			if (rule >= 0 && !ValueCanBeReplaced (js1, vCode, pos, posEnd, inBraces))
+				rule = -1;
+		}
+
+		if (rule < 0)
+		{
+			js2.insert (js2.end(), js1.begin() + pos, js1.begin() + posEnd);
+			pos = posEnd;
+			continue;
+		}
+
+		int saved = (posEnd - pos) - repl.size();
+
+		// "return true" -> "return!0"
+		if (repl[0] == '!' && js2.size() >= 2 && js2.back() == ' ' && IsNameChar (js2[js2.size() - 2]))
+		{
+			js2.pop_back();
+			saved++;
+		}
+
+		js2.insert (js2.end(), repl.begin(), repl.end());
+		literalSaved[rule] += saved;
+		pos = posEnd;
+	}
+
+	js1.assign (js2.begin(), js2.end());
+}
+
+//-----------------------------------------------------------------------------
+// Statement compaction
+
+std::atomic<int> statementSaved[StmtRuleCount];
+
+static bool IsStatementContext (const std::vector<char>& vBrackets)
+{
+	// Statements live at the top level and in braces; a ';' inside (...)
+	// or [...] belongs to a for header or is nothing to do with us.
+	return vBrackets.empty() || vBrackets.back() == '{';
+}
+
+static std::string WordBefore (const std::vector<uint8_t>& js1, int pos)
+{
+	// The name that ends just before pos, skipping whitespace, if any.
+	while (--pos >= 0 && isspace (js1[pos]))
+		;
+	int posEnd = pos + 1;
+	while (pos >= 0 && IsNameChar (js1[pos]))
+		pos--;
+	return std::string (js1.begin() + pos + 1, js1.begin() + posEnd);
+}
+
+static bool WordAt (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, int pos, const std::string& word)
+{
+	int posEnd = pos + word.size();
+	return posEnd <= (int)js1.size() && vCode[pos] && std::equal (word.begin(), word.end(), js1.begin() + pos)
+		&& (posEnd == (int)js1.size() || !IsNameChar (js1[posEnd]));
+}
+
+void CompactStatements (std::vector<uint8_t>& js1, int rules)
+{
+	std::vector<bool> vCode = MapCode (js1);
+	std::vector<char> vBrackets;	// Open brackets, innermost last.
+	std::vector<int> vParens;		// Positions of the open '('s.
+	std::vector<std::string> vStatement (1);	// Per bracket depth: "var", "let" or "const" if the
+												// current statement is a declaration, else empty.
+
+	// The last char written that wasn't whitespace or a comment and, if it
+	// was ')', the word before its '('.
+	uint8_t prev = 0;
+	std::string parenWord;
+	bool inComment = false;
+
+	std::vector<uint8_t> js2;
+	int size = js1.size();
+	int pos = 0;
+	while (pos < size)
+	{
+		uint8_t c = js1[pos];
+		if (!vCode[pos] || isspace (c))
+		{
+			if (!vCode[pos])
+			{
+				if (pos == 0 || vCode[pos - 1])
+					inComment = c == '/' && pos + 1 < size && (js1[pos + 1] == '/' || js1[pos + 1] == '*');
+				if (!inComment)
+					prev = c;
+			}
+
+			// A line break at statement level may have ended a statement.
+			if (vCode[pos] && c == '\n')
+				vStatement.back().clear();
+			js2.push_back (c);
+			pos++;
+			continue;
+		}
+
+		if (c == ';' && IsStatementContext (vBrackets))
+		{
+			// A ';' that is all of an if/while/for/with/else/do/label body
+			// has to stay.
+			bool isBody = prev == ':'
+				|| (prev == ')' && (parenWord == "if" || parenWord == "while" || parenWord == "for" || parenWord == "with"))
+				|| (IsNameChar (prev) && (WordBefore (js2, js2.size()) == "else" || WordBefore (js2, js2.size()) == "do"));
+
+			int posNext = SkipSpaceAndComments (js1, vCode, pos + 1);
+			int posNextWs = pos + 1;	// Next char that isn't whitespace, comments count.
+			while (posNextWs < size && vCode[posNextWs] && isspace (js1[posNextWs]))
+				posNextWs++;
+
+			int rule = -1;
+			if ((rules & (1 << StmtEmpty)) && (prev == ';' || prev == '{'))
+				rule = StmtEmpty;
+			else if ((rules & (1 << StmtBrace)) && !isBody && posNext < size && js1[posNext] == '}')
+				rule = StmtBrace;
+			else if ((rules & (1 << StmtTrailing)) && !isBody && posNext >= size && vBrackets.empty())
+				rule = StmtTrailing;
+			if (rule >= 0)
+			{
+				statementSaved[rule]++;
+				pos++;
+				continue;
+			}
+
+			// var a=1;var b=2 -> var a=1,b=2
+			const std::string& kind = vStatement.back();
+			if ((rules & (1 << StmtVar)) && kind.size() && posNextWs < size && WordAt (js1, vCode, posNextWs, kind))
+			{
+				int posName = posNextWs + kind.size();
+				while (posName < size && vCode[posName] && isspace (js1[posName]))
+					posName++;
+				js2.push_back (',');
+				prev = ',';
+				statementSaved[StmtVar] += (posName - pos) - 1;
+				pos = posName;
+				continue;
+			}
+
+			vStatement.back().clear();
+			js2.push_back (c);
+			prev = c;
+			pos++;
+			continue;
+		}
+
+		// The start of a statement: see if it's a declaration. After a '}'
+		// only a name can start one; anything else carries on an expression,
+		// eg. var a={},b.
+		if (IsStatementContext (vBrackets) && (prev == 0 || prev == ';' || prev == '{' || (prev == '}' && IsNameChar (c))))
+		{
+			vStatement.back().clear();
+			for (auto kind : { "var", "let", "const" })
+			{
+				if (WordAt (js1, vCode, pos, kind))
+					vStatement.back() = kind;
+			}
+		}
+
+		if (c == '(' || c == '[' || c == '{')
+		{
+			vBrackets.push_back (c);
+			vStatement.push_back (std::string());
+			if (c == '(')
+				vParens.push_back (pos);
+		}
+		else if ((c == ')' || c == ']' || c == '}') && vBrackets.size())
+		{
+			vBrackets.pop_back();
+			vStatement.pop_back();
+			if (c == ')' && vParens.size())
+			{
+				parenWord = WordBefore (js1, vParens.back());
+				vParens.pop_back();
+			}
+		}
+
+		// Copy a name whole, so prev is its last char.
+		int posEnd = pos + 1;
+		if (IsNameChar (c))
+		{
+			while (posEnd < size && vCode[posEnd] && IsNameChar (js1[posEnd]))
+				posEnd++;
+		}
+		js2.insert (js2.end(), js1.begin() + pos, js1.begin() + posEnd);
+		prev = js1[posEnd - 1];
+		pos = posEnd;
+	}
+
+	js1.assign (js2.begin(), js2.end());
+}
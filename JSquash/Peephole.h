@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <atomic>
+
+// Peephole passes over the output of Parse(). Each pass copies quoted
+// strings, regex literals, comments and the text of template literals
+// through untouched (see MapCode) and reports how many bytes each of its
+// rules saved.
+
+//-----------------------------------------------------------------------------
+// Literal shortening.
+//
+//	LitExponent		1000000 -> 1e6, 0.001 -> 1e-3
+//	LitFraction		0.50 -> .5, 2.0 -> 2
+//	LitHex			0xFF -> 255, or decimal -> hex when that's shorter
+//	LitBoolean		true -> !0, false -> !1
+//	LitUndefined	undefined -> void 0 (not if anything declares undefined)
+//
+// `1000000 true` stays as it is; the same inside ${...} is shortened.
+// true?.x stays too, as !0?.x would be !(0?.x).
+//
+enum LiteralRule { LitExponent, LitFraction, LitHex, LitBoolean, LitUndefined, LitRuleCount };
+
+// Bytes saved by each rule, over all calls (which may be concurrent).
+extern std::atomic<int> literalSaved[LitRuleCount];
+
+// rules is a bit mask of (1 << LiteralRule).
+void ShortenLiterals (std::vector<uint8_t>& js1, int rules);
+
+//-----------------------------------------------------------------------------
+// Statement compaction, for after whitespace removal.
+//
+//	StmtVar			var a=1;var b=2 -> var a=1,b=2 (let and const likewise)
+//	StmtBrace		;} -> }
+//	StmtEmpty		;; -> ;, {; -> {
+//	StmtTrailing	drops a ';' at the very end
+//
+// A ';' that is the whole body of an if, while, for, with, else, do or a
+// label is never dropped, nor is one in a for header.
+//
+enum StatementRule { StmtVar, StmtBrace, StmtEmpty, StmtTrailing, StmtRuleCount };
+
+// Bytes saved by each rule, over all calls (which may be concurrent).
+extern std::atomic<int> statementSaved[StmtRuleCount];
+
+// rules is a bit mask of (1 << StatementRule).
+void CompactStatements (std::vector<uint8_t>& js1, int rules);
@@ -0,0 +1,175 @@
+#include "pch.h"
+#include "Common.h"
+#include "Shard.h"
+#include "CodeMap.h"
+#include <cstring>
+#include <string>
+#include <map>
+#include <algorithm>
+
+static bool StartsStatement (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, size_t pos)
+{
+	// True if the code at pos, after any whitespace, is a keyword that can't
+	// carry on an expression. "while" isn't one: it could end a do loop.
+	while (pos < js1.size() && vCode[pos] && isspace (js1[pos]))
+		pos++;
+
+	const char* const keywords[] = {
+		"var", "const", "function", "class", "if", "for", "do", "try", "switch", "return", "throw"
+	};
+	for (auto k : keywords)
+	{
+		size_t len = strlen (k);
+		size_t posEnd = pos + len;
+		if (posEnd <= js1.size() && vCode[pos] && std::equal (k, k + len, js1.begin() + pos)
+			&& (posEnd == js1.size() || !IsNameChar (js1[posEnd])))
+			return true;
+	}
+	return false;
+}
+
+static bool IsWordAt (const std::vector<uint8_t>& js1, size_t pos, const char* word)
+{
+	size_t len = strlen (word);
+	return pos + len <= js1.size() && std::equal (word, word + len, js1.begin() + pos)
+		&& (pos == 0 || !IsNameChar (js1[pos - 1]))
+		&& (pos + len == js1.size() || !IsNameChar (js1[pos + len]));
+}
+
+static bool ContinuesStatement (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, size_t pos, bool inDo)
+{
+	// True if the code at pos carries on the statement before it, so the
+	// two can't go in different shards: if (a) b(); else c(), try {} catch
+	// (e) {} finally {}, or do x(); while (y).
+	int posWord = 0;
+	if (!IsNameChar (NextCodeChar (js1, vCode, pos, &posWord)))
+		return false;
+	return IsWordAt (js1, posWord, "else") || IsWordAt (js1, posWord, "catch")
+		|| IsWordAt (js1, posWord, "finally") || (inDo && IsWordAt (js1, posWord, "while"));
+}
+
+static std::string DeclaredFunction (const std::vector<uint8_t>& js1, const std::vector<bool>& vCode, size_t pos)
+{
+	// If a function declaration starts at pos, the name it declares, else "".
+	// A function in an expression, eg. "x = function f() {}", isn't one.
+	if (!IsWordAt (js1, pos, "function"))
+		return "";
+	int c = PrevCodeChar (js1, vCode, pos);
+	if (c && c != ';' && c != '}')
+	{
+		// async function f() {}
+		size_t posWord = pos;
+		while (posWord > 0 && isspace (js1[posWord - 1]))
+			posWord--;
+		if (posWord < 5 || !IsWordAt (js1, posWord - 5, "async"))
+			return "";
+		c = PrevCodeChar (js1, vCode, posWord - 5);
+		if (c && c != ';' && c != '}')
+			return "";
+	}
+
+	int posName = 0;
+	int c1 = NextCodeChar (js1, vCode, pos + 8, &posName);
+	if (c1 == '*')
+		c1 = NextCodeChar (js1, vCode, posName + 1, &posName);
+	if (!IsNameChar (c1))
+		return "";
+	size_t posEnd = posName;
+	while (posEnd < js1.size() && IsNameChar (js1[posEnd]))
+		posEnd++;
+	return std::string (js1.begin() + posName, js1.begin() + posEnd);
+}
+
+std::vector<size_t> FindShardBreaks (const std::vector<uint8_t>& js1, size_t budget)
+{
+	// First every place a cut could go, then pick from those.
+	std::vector<bool> vCode = MapCode (js1);
+	std::vector<size_t> vCuts;
+	std::map<std::string, size_t> mDeclared;	// Top-level function declarations.
+	int depth = 0;
+	int openDo = 0;	// Top-level do loops still waiting for their while.
+	for (size_t pos = 0; pos < js1.size(); ++pos)
+	{
+		if (!vCode[pos])
+			continue;
+		uint8_t c = js1[pos];
+		if (strchr ("([{", c))
+			depth++;
+		else if (strchr (")]}", c))
+			depth--;
+
+		if (depth == 0 && IsWordAt (js1, pos, "do"))
+			openDo++;
+		else if (depth == 0 && openDo && IsWordAt (js1, pos, "while"))
+			openDo--;
+
+		if (depth == 0 && (c == ';' || (c == '}' && StartsStatement (js1, vCode, pos + 1)))
+			&& !ContinuesStatement (js1, vCode, pos + 1, openDo > 0))
+			vCuts.push_back (pos + 1);
+
+		if (depth == 0 && c == 'f')
+		{
+			std::string name = DeclaredFunction (js1, vCode, pos);
+			if (name.size() && mDeclared.find (name) == mDeclared.end())
+				mDeclared[name] = pos;
+		}
+	}
+
+	// A function declaration is hoisted, so the code before it may call it.
+	// Each shard is a script of its own, though, and the function doesn't
+	// exist until the shard declaring it runs. So there's no cut between
+	// the first use of such a function and its declaration.
+	std::vector<int> vSpans (js1.size() + 2, 0);	// +1 where a no-cut span opens, -1 past its end.
+	for (size_t pos = 0; pos < js1.size(); ++pos)
+	{
+		if (!vCode[pos] || !IsNameChar (js1[pos]) || (pos > 0 && IsNameChar (js1[pos - 1])))
+			continue;
+		size_t posEnd = pos;
+		while (posEnd < js1.size() && IsNameChar (js1[posEnd]))
+			posEnd++;
+
+		auto it = mDeclared.find (std::string (js1.begin() + pos, js1.begin() + posEnd));
+		if (it != mDeclared.end() && pos < it->second && (pos == 0 || js1[pos - 1] != '.'))
+		{
+			vSpans[pos + 1]++;
+			vSpans[it->second + 1]--;
+			mDeclared.erase (it);	// The first use makes the longest span.
+		}
+		pos = posEnd - 1;
+	}
+	std::vector<bool> vNoCut (js1.size() + 1, false);
+	int spans = 0;
+	for (size_t pos = 0; pos <= js1.size(); ++pos)
+	{
+		spans += vSpans[pos];
+		vNoCut[pos] = spans > 0;
+	}
+	vCuts.erase (std::remove_if (vCuts.begin(), vCuts.end(), [&vNoCut](size_t pos) { return vNoCut[pos]; }), vCuts.end());
+
+	std::vector<size_t> vBreaks;
+	size_t posStart = 0;
+	size_t i = 0;
+	while (js1.size() - posStart > budget)
+	{
+		// The furthest cut within budget, else the nearest one beyond it.
+		size_t posBreak = 0;
+		for (; i < vCuts.size() && vCuts[i] - posStart <= budget; ++i)
+			posBreak = vCuts[i];
+		if (posBreak == 0)
+		{
+			while (i < vCuts.size() && vCuts[i] <= posStart)
+				i++;
+			if (i == vCuts.size())
+				break;
+			posBreak = vCuts[i++];
+		}
+		if (posBreak >= js1.size())
+			break;
+
+		vBreaks.push_back (posBreak);
+		posStart = posBreak;
+	}
+	vBreaks.push_back (js1.size());
+
+	return vBreaks;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+// Output sharding: the minified js cut into pieces that run one after
+// another as separate scripts, so they can be fetched in parallel.
+//
+// Cuts are only made between top-level statements: after a ';' outside all
+// brackets, or after a top-level '}' that is followed by a keyword that
+// can only start a statement (function, var, if, ...), and never before
+// an else, catch, finally or the while of a do loop. A function
+// declaration is only hoisted within its own script, so there's no cut
+// between a top-level function's first use and its declaration. Each
+// shard is as long as possible without going over the budget; where
+// there's no cut in reach, the shard runs on to the next one and is over
+// budget.
+
+// Returns the end position of each shard, the last being js1.size().
+std::vector<size_t> FindShardBreaks (const std::vector<uint8_t>& js1, size_t budget);